@@ -0,0 +1,425 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <vector>
+#include <algorithm>
+#include <limits>
+
+// External
+#include <MRH_Typedefs.h>
+
+// Project
+#include "./Levenshtein.h"
+
+// Pre-defined
+#ifndef LEVENSHTEIN_ENGINE
+    #define LEVENSHTEIN_ENGINE BIT_PARALLEL
+#endif
+
+namespace
+{
+    constexpr size_t us_WordBits = 64;
+    constexpr size_t us_Alphabet = 256;
+    constexpr size_t us_BandCellsPerBlock = 12; // Measured, band cells costing as much as one block
+    
+    size_t DynamicProgramming(std::string_view s_Row, std::string_view s_Column) noexcept
+    {
+        thread_local std::vector<size_t> v_Row;
+        v_Row.resize(s_Row.size() + 1);
+        
+        for (size_t i = 0; i <= s_Row.size(); ++i)
+        {
+            v_Row[i] = i;
+        }
+        
+        for (size_t j = 1; j <= s_Column.size(); ++j)
+        {
+            size_t us_Diagonal = v_Row[0];
+            v_Row[0] = j;
+            
+            for (size_t i = 1; i <= s_Row.size(); ++i)
+            {
+                size_t us_Above = v_Row[i];
+                
+                v_Row[i] = std::min({ v_Row[i] + 1,
+                                      v_Row[i - 1] + 1,
+                                      us_Diagonal + (s_Row[i - 1] == s_Column[j - 1] ? 0 : 1) });
+                us_Diagonal = us_Above;
+            }
+        }
+        
+        return v_Row[s_Row.size()];
+    }
+    
+    // Ukkonen band, cells further than the bound from the diagonal 
+    // can't be on a path within the bound
+    size_t DynamicProgrammingBand(std::string_view s_Row, std::string_view s_Column, size_t us_Max) noexcept
+    {
+        thread_local std::vector<size_t> v_Row;
+        size_t us_Exceeded = us_Max + 1;
+        
+        v_Row.assign(s_Row.size() + 1, us_Exceeded);
+        
+        for (size_t i = 0; i <= s_Row.size() && i <= us_Max; ++i)
+        {
+            v_Row[i] = i;
+        }
+        
+        for (size_t j = 1; j <= s_Column.size(); ++j)
+        {
+            size_t us_Low = (j > us_Max ? j - us_Max : 1);
+            size_t us_High = std::min(s_Row.size(), j + us_Max);
+            size_t us_Diagonal = v_Row[us_Low - 1];
+            
+            // Left band edge, either the first row or outside the band
+            v_Row[us_Low - 1] = (us_Low == 1 ? std::min(j, us_Exceeded) : us_Exceeded);
+            
+            size_t us_ColumnMin = v_Row[us_Low - 1];
+            
+            for (size_t i = us_Low; i <= us_High; ++i)
+            {
+                size_t us_Above = v_Row[i];
+                
+                v_Row[i] = std::min({ v_Row[i] + 1,
+                                      v_Row[i - 1] + 1,
+                                      us_Diagonal + (s_Row[i - 1] == s_Column[j - 1] ? 0 : 1),
+                                      us_Exceeded });
+                us_Diagonal = us_Above;
+                us_ColumnMin = std::min(us_ColumnMin, v_Row[i]);
+            }
+            
+            // Column minimums never decrease
+            if (us_ColumnMin > us_Max)
+            {
+                return us_Exceeded;
+            }
+        }
+        
+        return v_Row[s_Row.size()];
+    }
+    
+    // Myers / Hyyrö, the row string is encoded as match bit vectors and 
+    // one column of vertical deltas is updated per column character
+    // @NOTE: Values never decrease along a diagonal, the diagonal leading 
+    //        to the final cell stops the evaluation once above the bound
+    size_t BitParallelWord(std::string_view s_Row, std::string_view s_Column, size_t us_Max) noexcept
+    {
+        thread_local MRH_Uint64 p_Match[us_Alphabet] = { 0 };
+        
+        for (size_t i = 0; i < s_Row.size(); ++i)
+        {
+            p_Match[static_cast<MRH_Uint8>(s_Row[i])] |= (1ULL << i);
+        }
+        
+        MRH_Uint64 u64_Last = 1ULL << (s_Row.size() - 1);
+        MRH_Uint64 u64_Pv = ~0ULL;
+        MRH_Uint64 u64_Mv = 0;
+        size_t us_Distance = s_Row.size();
+        size_t us_Offset = s_Column.size() - s_Row.size();
+        bool b_Bounded = us_Max < s_Column.size();
+        
+        for (size_t j = 0; j < s_Column.size(); ++j)
+        {
+            MRH_Uint64 u64_Eq = p_Match[static_cast<MRH_Uint8>(s_Column[j])];
+            MRH_Uint64 u64_Xv = u64_Eq | u64_Mv;
+            MRH_Uint64 u64_Xh = (((u64_Eq & u64_Pv) + u64_Pv) ^ u64_Pv) | u64_Eq;
+            MRH_Uint64 u64_Ph = u64_Mv | ~(u64_Xh | u64_Pv);
+            MRH_Uint64 u64_Mh = u64_Pv & u64_Xh;
+            
+            if (u64_Ph & u64_Last)
+            {
+                ++us_Distance;
+            }
+            else if (u64_Mh & u64_Last)
+            {
+                --us_Distance;
+            }
+            
+            // The first row grows by one per column
+            u64_Ph = (u64_Ph << 1) | 1;
+            u64_Mh = u64_Mh << 1;
+            u64_Pv = u64_Mh | ~(u64_Xv | u64_Ph);
+            u64_Mv = u64_Ph & u64_Xv;
+            
+            // Column j + 1 is done, sum the vertical deltas up to the 
+            // diagonal row
+            if (b_Bounded == true && j + 1 > us_Offset)
+            {
+                size_t us_Diagonal = j + 1 - us_Offset;
+                MRH_Uint64 u64_Mask = (us_Diagonal < us_WordBits ? (1ULL << us_Diagonal) - 1 : ~0ULL);
+                size_t us_Cell = (j + 1) + __builtin_popcountll(u64_Pv & u64_Mask) - __builtin_popcountll(u64_Mv & u64_Mask);
+                
+                if (us_Cell > us_Max)
+                {
+                    us_Distance = us_Max + 1;
+                    break;
+                }
+            }
+        }
+        
+        // Only the row characters were set
+        for (size_t i = 0; i < s_Row.size(); ++i)
+        {
+            p_Match[static_cast<MRH_Uint8>(s_Row[i])] = 0;
+        }
+        
+        return us_Distance;
+    }
+    
+    // Blocked variant for rows longer than a word, the horizontal delta 
+    // of each block is carried into the next block
+    size_t BitParallelBlock(std::string_view s_Row, std::string_view s_Column) noexcept
+    {
+        thread_local std::vector<MRH_Uint64> v_Match;
+        thread_local std::vector<MRH_Uint64> v_Pv;
+        thread_local std::vector<MRH_Uint64> v_Mv;
+        
+        size_t us_Blocks = (s_Row.size() + us_WordBits - 1) / us_WordBits;
+        
+        v_Match.assign(us_Blocks * us_Alphabet, 0);
+        v_Pv.assign(us_Blocks, ~0ULL);
+        v_Mv.assign(us_Blocks, 0);
+        
+        for (size_t i = 0; i < s_Row.size(); ++i)
+        {
+            v_Match[(static_cast<MRH_Uint8>(s_Row[i]) * us_Blocks) + (i / us_WordBits)] |= (1ULL << (i % us_WordBits));
+        }
+        
+        MRH_Uint64 u64_Last = 1ULL << ((s_Row.size() - 1) % us_WordBits);
+        size_t us_Distance = s_Row.size();
+        
+        for (size_t j = 0; j < s_Column.size(); ++j)
+        {
+            const MRH_Uint64* p_Eq = &(v_Match[static_cast<MRH_Uint8>(s_Column[j]) * us_Blocks]);
+            int i_Carry = 1; // The first row grows by one per column
+            
+            for (size_t b = 0; b < us_Blocks; ++b)
+            {
+                MRH_Uint64 u64_Pv = v_Pv[b];
+                MRH_Uint64 u64_Mv = v_Mv[b];
+                MRH_Uint64 u64_Eq = p_Eq[b];
+                MRH_Uint64 u64_High = (b + 1 < us_Blocks ? (1ULL << (us_WordBits - 1)) : u64_Last);
+                
+                MRH_Uint64 u64_Xv = u64_Eq | u64_Mv;
+                
+                if (i_Carry < 0)
+                {
+                    u64_Eq |= 1;
+                }
+                
+                MRH_Uint64 u64_Xh = (((u64_Eq & u64_Pv) + u64_Pv) ^ u64_Pv) | u64_Eq;
+                MRH_Uint64 u64_Ph = u64_Mv | ~(u64_Xh | u64_Pv);
+                MRH_Uint64 u64_Mh = u64_Pv & u64_Xh;
+                int i_Out = 0;
+                
+                if (u64_Ph & u64_High)
+                {
+                    i_Out = 1;
+                }
+                else if (u64_Mh & u64_High)
+                {
+                    i_Out = -1;
+                }
+                
+                u64_Ph <<= 1;
+                u64_Mh <<= 1;
+                
+                if (i_Carry < 0)
+                {
+                    u64_Mh |= 1;
+                }
+                else if (i_Carry > 0)
+                {
+                    u64_Ph |= 1;
+                }
+                
+                v_Pv[b] = u64_Mh | ~(u64_Xv | u64_Ph);
+                v_Mv[b] = u64_Ph & u64_Xv;
+                i_Carry = i_Out;
+            }
+            
+            us_Distance += i_Carry;
+        }
+        
+        return us_Distance;
+    }
+}
+
+
+//*************************************************************************************
+// Compare
+//*************************************************************************************
+
+size_t Levenshtein::Distance(std::string_view s_A, std::string_view s_B) noexcept
+{
+    return Distance(s_A, s_B, LEVENSHTEIN_ENGINE);
+}
+
+size_t Levenshtein::Distance(std::string_view s_A, std::string_view s_B, Engine e_Engine) noexcept
+{
+    // Keep the shorter string as the row
+    std::string_view s_Row = (s_A.size() < s_B.size() ? s_A : s_B);
+    std::string_view s_Column = (s_A.size() < s_B.size() ? s_B : s_A);
+    
+    if (s_Row.size() == 0)
+    {
+        return s_Column.size();
+    }
+    
+    switch (e_Engine)
+    {
+        case BIT_PARALLEL:
+            if (s_Row.size() <= us_WordBits)
+            {
+                return BitParallelWord(s_Row, s_Column, std::numeric_limits<size_t>::max());
+            }
+            return BitParallelBlock(s_Row, s_Column);
+            
+        default:
+            return DynamicProgramming(s_Row, s_Column);
+    }
+}
+
+float Levenshtein::Similarity(std::string_view s_A, std::string_view s_B) noexcept
+{
+    return Similarity(s_A, s_B, LEVENSHTEIN_ENGINE);
+}
+
+float Levenshtein::Similarity(std::string_view s_A, std::string_view s_B, Engine e_Engine) noexcept
+{
+    size_t us_Length = std::max(s_A.size(), s_B.size());
+    
+    if (us_Length == 0)
+    {
+        return 1.f;
+    }
+    
+    return 1.f - (static_cast<float>(Distance(s_A, s_B, e_Engine)) / static_cast<float>(us_Length));
+}
+
+size_t Levenshtein::BoundedDistance(std::string_view s_A, std::string_view s_B, size_t us_Max) noexcept
+{
+    return BoundedDistance(s_A, s_B, us_Max, LEVENSHTEIN_ENGINE);
+}
+
+size_t Levenshtein::BoundedDistance(std::string_view s_A, std::string_view s_B, size_t us_Max, Engine e_Engine) noexcept
+{
+    std::string_view s_Row = (s_A.size() < s_B.size() ? s_A : s_B);
+    std::string_view s_Column = (s_A.size() < s_B.size() ? s_B : s_A);
+    
+    // Each length difference is one insertion
+    if (s_Column.size() - s_Row.size() > us_Max)
+    {
+        return us_Max + 1;
+    }
+    else if (s_Row.size() == 0)
+    {
+        return s_Column.size();
+    }
+    
+    switch (e_Engine)
+    {
+        case BIT_PARALLEL:
+            // Short rows track the final diagonal in a single word, longer 
+            // rows only evaluate the band around it
+            if (s_Row.size() <= us_WordBits)
+            {
+                return std::min(BitParallelWord(s_Row, s_Column, us_Max), us_Max + 1);
+            }
+            else if ((us_Max * 2) + 1 > us_BandCellsPerBlock * ((s_Row.size() + us_WordBits - 1) / us_WordBits))
+            {
+                // Wide bands are slower than all blocks
+                return std::min(BitParallelBlock(s_Row, s_Column), us_Max + 1);
+            }
+            return DynamicProgrammingBand(s_Row, s_Column, us_Max);
+            
+        default:
+            return DynamicProgrammingBand(s_Row, s_Column, us_Max);
+    }
+}
+
+bool Levenshtein::Match(std::string_view s_A, std::string_view s_B, float f32_Similarity) noexcept
+{
+    // Equal strings have the highest similarity
+    if (f32_Similarity > 1.f)
+    {
+        return false;
+    }
+    
+    size_t us_Max = MaxDistance(std::max(s_A.size(), s_B.size()), f32_Similarity);
+    
+    return BoundedDistance(s_A, s_B, us_Max) <= us_Max;
+}
+
+bool Levenshtein::Match(std::string_view s_A, std::string_view s_B, float f32_Similarity, float& f32_Result) noexcept
+{
+    if (f32_Similarity > 1.f)
+    {
+        return false;
+    }
+    
+    size_t us_Length = std::max(s_A.size(), s_B.size());
+    size_t us_Max = MaxDistance(us_Length, f32_Similarity);
+    size_t us_Distance = BoundedDistance(s_A, s_B, us_Max);
+    
+    if (us_Distance > us_Max)
+    {
+        return false;
+    }
+    
+    // A bounded distance within the bound is the full distance
+    f32_Result = (us_Length == 0 ? 1.f : 1.f - (static_cast<float>(us_Distance) / static_cast<float>(us_Length)));
+    return true;
+}
+
+size_t Levenshtein::MaxDistance(size_t us_Length, float f32_Similarity) noexcept
+{
+    if (us_Length == 0)
+    {
+        return 0;
+    }
+    
+    float f32_Length = static_cast<float>(us_Length);
+    float f32_Estimate = (1.f - f32_Similarity) * f32_Length;
+    size_t us_Distance;
+    
+    if (f32_Estimate <= 0.f)
+    {
+        us_Distance = 0;
+    }
+    else if (f32_Estimate >= f32_Length)
+    {
+        us_Distance = us_Length;
+    }
+    else
+    {
+        us_Distance = static_cast<size_t>(f32_Estimate);
+    }
+    
+    // Same float expression as Similarity(), rounding has to match
+    while (us_Distance > 0 && 1.f - (static_cast<float>(us_Distance) / f32_Length) < f32_Similarity)
+    {
+        --us_Distance;
+    }
+    
+    while (us_Distance < us_Length && 1.f - (static_cast<float>(us_Distance + 1) / f32_Length) >= f32_Similarity)
+    {
+        ++us_Distance;
+    }
+    
+    return us_Distance;
+}
@@ -0,0 +1,165 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef Levenshtein_h
+#define Levenshtein_h
+
+// C / C++
+#include <string_view>
+
+// External
+
+// Project
+
+
+namespace Levenshtein
+{
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    enum Engine
+    {
+        DYNAMIC_PROGRAMMING = 0,
+        BIT_PARALLEL = 1,
+        
+        ENGINE_MAX = BIT_PARALLEL,
+        
+        ENGINE_COUNT = ENGINE_MAX + 1
+    };
+    
+    //*************************************************************************************
+    // Compare
+    //*************************************************************************************
+    
+    /**
+     *  Get the edit distance between two strings with the default engine.
+     *
+     *  \param s_A The first string.
+     *  \param s_B The second string.
+     *
+     *  \return The edit distance.
+     */
+    
+    size_t Distance(std::string_view s_A, std::string_view s_B) noexcept;
+    
+    /**
+     *  Get the edit distance between two strings.
+     *
+     *  \param s_A The first string.
+     *  \param s_B The second string.
+     *  \param e_Engine The engine to compute the distance with.
+     *
+     *  \return The edit distance.
+     */
+    
+    size_t Distance(std::string_view s_A, std::string_view s_B, Engine e_Engine) noexcept;
+    
+    /**
+     *  Get the similarity of two strings with the default engine.
+     *
+     *  \param s_A The first string.
+     *  \param s_B The second string.
+     *
+     *  \return The similarity between 0.0 (different) and 1.0 (equal).
+     */
+    
+    float Similarity(std::string_view s_A, std::string_view s_B) noexcept;
+    
+    /**
+     *  Get the similarity of two strings.
+     *
+     *  \param s_A The first string.
+     *  \param s_B The second string.
+     *  \param e_Engine The engine to compute the distance with.
+     *
+     *  \return The similarity between 0.0 (different) and 1.0 (equal).
+     */
+    
+    float Similarity(std::string_view s_A, std::string_view s_B, Engine e_Engine) noexcept;
+    
+    /**
+     *  Get the edit distance between two strings up to a bound with the 
+     *  default engine. The evaluation stops once the bound can no longer 
+     *  be reached.
+     *
+     *  \param s_A The first string.
+     *  \param s_B The second string.
+     *  \param us_Max The highest distance of interest.
+     *
+     *  \return The edit distance if it is lower or equal to the bound, 
+     *          the bound + 1 if not.
+     */
+    
+    size_t BoundedDistance(std::string_view s_A, std::string_view s_B, size_t us_Max) noexcept;
+    
+    /**
+     *  Get the edit distance between two strings up to a bound with a 
+     *  engine. The dynamic programming engine evaluates a diagonal band, 
+     *  the bit parallel engine picks the fastest bounded evaluation.
+     *
+     *  \param s_A The first string.
+     *  \param s_B The second string.
+     *  \param us_Max The highest distance of interest.
+     *  \param e_Engine The engine to compute the distance with.
+     *
+     *  \return The edit distance if it is lower or equal to the bound, 
+     *          the bound + 1 if not.
+     */
+    
+    size_t BoundedDistance(std::string_view s_A, std::string_view s_B, size_t us_Max, Engine e_Engine) noexcept;
+    
+    /**
+     *  Check if two strings reach a similarity. The result is the same 
+     *  as comparing the result of Similarity().
+     *
+     *  \param s_A The first string.
+     *  \param s_B The second string.
+     *  \param f32_Similarity The required similarity.
+     *
+     *  \return true if the similarity is reached, false if not.
+     */
+    
+    bool Match(std::string_view s_A, std::string_view s_B, float f32_Similarity) noexcept;
+    
+    /**
+     *  Check if two strings reach a similarity and get the similarity 
+     *  on a match.
+     *
+     *  \param s_A The first string.
+     *  \param s_B The second string.
+     *  \param f32_Similarity The required similarity.
+     *  \param f32_Result The similarity of both strings. Only set on a match.
+     *
+     *  \return true if the similarity is reached, false if not.
+     */
+    
+    bool Match(std::string_view s_A, std::string_view s_B, float f32_Similarity, float& f32_Result) noexcept;
+    
+    /**
+     *  Get the highest edit distance which still reaches a similarity.
+     *
+     *  \param us_Length The length of the longer string.
+     *  \param f32_Similarity The required similarity.
+     *
+     *  \return The highest edit distance. The length is returned if every 
+     *          distance reaches the similarity.
+     */
+    
+    size_t MaxDistance(size_t us_Length, float f32_Similarity) noexcept;
+}
+
+#endif /* Levenshtein_h */
@@ -0,0 +1,278 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+
+// External
+#include <MRH_Typedefs.h>
+
+// Project
+#include "./Normalise.h"
+
+namespace
+{
+    enum Class
+    {
+        LETTER = 0, // Anything kept
+        SEPARATOR = 1,
+        REMOVED = 2
+    };
+    
+    // Returns the code point length, 0 for invalid UTF-8
+    size_t Decode(std::string_view s_String, size_t us_Pos, MRH_Uint32& u32_CodePoint) noexcept
+    {
+        MRH_Uint8 u8_Lead = static_cast<MRH_Uint8>(s_String[us_Pos]);
+        size_t us_Length;
+        
+        if (u8_Lead < 0x80)
+        {
+            u32_CodePoint = u8_Lead;
+            return 1;
+        }
+        else if ((u8_Lead & 0xE0) == 0xC0)
+        {
+            u32_CodePoint = u8_Lead & 0x1F;
+            us_Length = 2;
+        }
+        else if ((u8_Lead & 0xF0) == 0xE0)
+        {
+            u32_CodePoint = u8_Lead & 0x0F;
+            us_Length = 3;
+        }
+        else if ((u8_Lead & 0xF8) == 0xF0)
+        {
+            u32_CodePoint = u8_Lead & 0x07;
+            us_Length = 4;
+        }
+        else
+        {
+            return 0;
+        }
+        
+        if (s_String.size() - us_Pos < us_Length)
+        {
+            return 0;
+        }
+        
+        for (size_t i = 1; i < us_Length; ++i)
+        {
+            MRH_Uint8 u8_Next = static_cast<MRH_Uint8>(s_String[us_Pos + i]);
+            
+            if ((u8_Next & 0xC0) != 0x80)
+            {
+                return 0;
+            }
+            
+            u32_CodePoint = (u32_CodePoint << 6) | (u8_Next & 0x3F);
+        }
+        
+        // Reject overlong encodings
+        if ((us_Length == 2 && u32_CodePoint < 0x80) ||
+            (us_Length == 3 && u32_CodePoint < 0x800) ||
+            (us_Length == 4 && (u32_CodePoint < 0x10000 || u32_CodePoint > 0x10FFFF)))
+        {
+            return 0;
+        }
+        
+        return us_Length;
+    }
+    
+    void Encode(MRH_Uint32 u32_CodePoint, std::string& s_Result)
+    {
+        if (u32_CodePoint < 0x80)
+        {
+            s_Result += static_cast<char>(u32_CodePoint);
+        }
+        else if (u32_CodePoint < 0x800)
+        {
+            s_Result += static_cast<char>(0xC0 | (u32_CodePoint >> 6));
+            s_Result += static_cast<char>(0x80 | (u32_CodePoint & 0x3F));
+        }
+        else if (u32_CodePoint < 0x10000)
+        {
+            s_Result += static_cast<char>(0xE0 | (u32_CodePoint >> 12));
+            s_Result += static_cast<char>(0x80 | ((u32_CodePoint >> 6) & 0x3F));
+            s_Result += static_cast<char>(0x80 | (u32_CodePoint & 0x3F));
+        }
+        else
+        {
+            s_Result += static_cast<char>(0xF0 | (u32_CodePoint >> 18));
+            s_Result += static_cast<char>(0x80 | ((u32_CodePoint >> 12) & 0x3F));
+            s_Result += static_cast<char>(0x80 | ((u32_CodePoint >> 6) & 0x3F));
+            s_Result += static_cast<char>(0x80 | (u32_CodePoint & 0x3F));
+        }
+    }
+    
+    Class GetClass(MRH_Uint32 u32_CodePoint) noexcept
+    {
+        if (u32_CodePoint < 0x80)
+        {
+            if ((u32_CodePoint >= '0' && u32_CodePoint <= '9') ||
+                (u32_CodePoint >= 'A' && u32_CodePoint <= 'Z') ||
+                (u32_CodePoint >= 'a' && u32_CodePoint <= 'z'))
+            {
+                return LETTER;
+            }
+            
+            // Apostrophes join words
+            return (u32_CodePoint == '\'' || u32_CodePoint == '`' ? REMOVED : SEPARATOR);
+        }
+        
+        switch (u32_CodePoint)
+        {
+            // Latin-1 space and punctuation
+            case 0x00A0:
+            case 0x00A1:
+            case 0x00A7:
+            case 0x00AB:
+            case 0x00B6:
+            case 0x00B7:
+            case 0x00BB:
+            case 0x00BF:
+            // Other spaces
+            case 0x1680:
+            case 0x3000:
+            case 0x3001:
+            case 0x3002:
+            case 0x3003:
+                return SEPARATOR;
+                
+            // Apostrophes
+            case 0x02BC:
+            case 0x2019:
+                return REMOVED;
+                
+            default:
+                break;
+        }
+        
+        // General punctuation, including spaces and dashes
+        if (u32_CodePoint >= 0x2000 && u32_CodePoint <= 0x206F)
+        {
+            return SEPARATOR;
+        }
+        
+        return LETTER;
+    }
+    
+    // Simple case folding for Latin, Greek and Cyrillic
+    void Fold(MRH_Uint32 u32_CodePoint, std::string& s_Result)
+    {
+        if (u32_CodePoint >= 'A' && u32_CodePoint <= 'Z')
+        {
+            u32_CodePoint += 0x20;
+        }
+        else if (u32_CodePoint < 0x80)
+        {}
+        else if (u32_CodePoint >= 0x00C0 && u32_CodePoint <= 0x00DE && u32_CodePoint != 0x00D7)
+        {
+            u32_CodePoint += 0x20;
+        }
+        else if (u32_CodePoint == 0x00DF)
+        {
+            s_Result += "ss";
+            return;
+        }
+        else if (u32_CodePoint == 0x0130)
+        {
+            u32_CodePoint = 'i';
+        }
+        else if ((u32_CodePoint >= 0x0100 && u32_CodePoint <= 0x012F) ||
+                 (u32_CodePoint >= 0x0132 && u32_CodePoint <= 0x0137) ||
+                 (u32_CodePoint >= 0x014A && u32_CodePoint <= 0x0177) ||
+                 (u32_CodePoint >= 0x0460 && u32_CodePoint <= 0x0481) ||
+                 (u32_CodePoint >= 0x048A && u32_CodePoint <= 0x04BF))
+        {
+            u32_CodePoint |= 1;
+        }
+        else if ((u32_CodePoint >= 0x0139 && u32_CodePoint <= 0x0148) ||
+                 (u32_CodePoint >= 0x0179 && u32_CodePoint <= 0x017E))
+        {
+            u32_CodePoint += (u32_CodePoint & 1);
+        }
+        else if (u32_CodePoint == 0x0178)
+        {
+            u32_CodePoint = 0x00FF;
+        }
+        else if ((u32_CodePoint >= 0x0391 && u32_CodePoint <= 0x03A1) ||
+                 (u32_CodePoint >= 0x03A3 && u32_CodePoint <= 0x03AB) ||
+                 (u32_CodePoint >= 0x0410 && u32_CodePoint <= 0x042F))
+        {
+            u32_CodePoint += 0x20;
+        }
+        else if (u32_CodePoint == 0x03C2)
+        {
+            u32_CodePoint = 0x03C3;
+        }
+        else if (u32_CodePoint >= 0x0400 && u32_CodePoint <= 0x040F)
+        {
+            u32_CodePoint += 0x50;
+        }
+        
+        Encode(u32_CodePoint, s_Result);
+    }
+}
+
+
+//*************************************************************************************
+// Normalise
+//*************************************************************************************
+
+std::string Normalise::String(std::string_view s_String)
+{
+    std::string s_Result;
+    bool b_Separate = false;
+    
+    s_Result.reserve(s_String.size());
+    
+    for (size_t i = 0; i < s_String.size();)
+    {
+        MRH_Uint32 u32_CodePoint;
+        size_t us_Length = Decode(s_String, i, u32_CodePoint);
+        
+        if (us_Length == 0)
+        {
+            // Invalid bytes could form a valid sequence once 
+            // removed characters are gone, replace them
+            u32_CodePoint = 0xFFFD;
+            us_Length = 1;
+        }
+        
+        i += us_Length;
+        
+        switch (GetClass(u32_CodePoint))
+        {
+            case SEPARATOR:
+                b_Separate = true;
+                break;
+                
+            case REMOVED:
+                break;
+                
+            default:
+                if (b_Separate == true && s_Result.size() > 0)
+                {
+                    s_Result += ' ';
+                }
+                
+                Fold(u32_CodePoint, s_Result);
+                b_Separate = false;
+                break;
+        }
+    }
+    
+    return s_Result;
+}
@@ -0,0 +1,49 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef Normalise_h
+#define Normalise_h
+
+// C / C++
+#include <string>
+#include <string_view>
+
+// External
+
+// Project
+
+
+namespace Normalise
+{
+    //*************************************************************************************
+    // Normalise
+    //*************************************************************************************
+    
+    /**
+     *  Normalise a UTF-8 string for comparison. Letters are case folded, 
+     *  punctuation is removed and whitespace is collapsed to single spaces 
+     *  without leading or trailing spaces. Invalid UTF-8 bytes are replaced 
+     *  by U+FFFD.
+     *
+     *  \param s_String The string to normalise.
+     *
+     *  \return The normalised string.
+     */
+    
+    std::string String(std::string_view s_String);
+}
+
+#endif /* Normalise_h */
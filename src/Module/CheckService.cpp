@@ -31,38 +31,69 @@
 // Constructor / Destructor
 //*************************************************************************************
 
-CheckService::CheckService(Service e_Service,
-                           bool& b_ServiceAvailable) : MRH_Module("CheckService"),
-                                                       c_Timer(SPEECH_OUTPUT_TIMEOUT_MS),
-                                                       e_Service(e_Service),
-                                                       b_ServiceAvailable(b_ServiceAvailable),
-                                                       e_Result(NOT_SET)
+CheckService::CheckService(MRH_Uint32 u32_ServiceMask,
+                           bool& b_ServiceAvailable,
+                           ServiceCache& c_ServiceCache) : MRH_Module("CheckService"),
+                                                           c_Timer(SPEECH_OUTPUT_TIMEOUT_MS),
+                                                           u32_ServiceMask(0),
+                                                           b_ServiceAvailable(b_ServiceAvailable),
+                                                           c_ServiceCache(c_ServiceCache)
 {
-    this->b_ServiceAvailable = false;
+    Reset(u32_ServiceMask);
+}
+
+CheckService::~CheckService() noexcept
+{}
+
+//*************************************************************************************
+// Reset
+//*************************************************************************************
+
+void CheckService::Reset(MRH_Uint32 u32_ServiceMask)
+{
+    c_Timer = MRH_ModuleTimer(SPEECH_OUTPUT_TIMEOUT_MS);
+    b_ServiceAvailable = false;
     
+    if ((u32_ServiceMask & ALL_MASK) == 0 || (u32_ServiceMask & ~static_cast<MRH_Uint32>(ALL_MASK)) != 0)
+    {
+        throw MRH_ModuleException("CheckService", 
+                                  "Unknown service to check!");
+    }
+    
+    this->u32_ServiceMask = u32_ServiceMask;
+    
+    // Request all at once, replies are collected in any order
     MRH_EventStorage& c_Storage = MRH_EventStorage::Singleton();
     
-    switch (e_Service)
+    for (size_t i = 0; i < SERVICE_COUNT; ++i)
     {
-        case LISTEN:
-            c_Storage.Add(MRH_EVD_CreateEvent(MRH_EVENT_LISTEN_AVAIL_U, NULL, 0));
-            break;
-        case SAY:
-            c_Storage.Add(MRH_EVD_CreateEvent(MRH_EVENT_SAY_AVAIL_U, NULL, 0));
-            break;
-        case APPLICATION:
-            c_Storage.Add(MRH_EVD_CreateEvent(MRH_EVENT_APP_AVAIL_U, NULL, 0));
-            break;
-            
-        default:
-            throw MRH_ModuleException("CheckService", 
-                                      "Unknown service to check!");
+        p_Result[i] = NOT_SET;
+        
+        if ((u32_ServiceMask & (1 << i)) == 0)
+        {
+            continue;
+        }
+        else if (c_ServiceCache.GetAvailable(static_cast<MRH_Uint32>(i)) == true)
+        {
+            p_Result[i] = AVAILABLE;
+            continue;
+        }
+        
+        switch (i)
+        {
+            case LISTEN:
+                c_Storage.Add(MRH_EVD_CreateEvent(MRH_EVENT_LISTEN_AVAIL_U, NULL, 0));
+                break;
+            case SAY:
+                c_Storage.Add(MRH_EVD_CreateEvent(MRH_EVENT_SAY_AVAIL_U, NULL, 0));
+                break;
+            case APPLICATION:
+                c_Storage.Add(MRH_EVD_CreateEvent(MRH_EVENT_APP_AVAIL_U, NULL, 0));
+                break;
+        }
     }
 }
 
-CheckService::~CheckService() noexcept
-{}
-
 //*************************************************************************************
 // Update
 //*************************************************************************************
@@ -70,6 +101,7 @@ CheckService::~CheckService() noexcept
 void CheckService::HandleEvent(const MRH_Event* p_Event) noexcept
 {
     MRH_EvD_Base_ServiceAvail_S_t c_ServiceAvail;
+    Service e_Service;
     
     if (MRH_EVD_ReadEvent(&c_ServiceAvail, p_Event->u32_Type, p_Event) < 0)
     {
@@ -81,35 +113,33 @@ void CheckService::HandleEvent(const MRH_Event* p_Event) noexcept
     switch (p_Event->u32_Type)
     {
         case MRH_EVENT_LISTEN_AVAIL_S:
-            if (e_Service != LISTEN)
-            {
-                return;
-            }
+            e_Service = LISTEN;
             break;
         case MRH_EVENT_SAY_AVAIL_S:
-            if (e_Service != SAY)
-            {
-                return;
-            }
+            e_Service = SAY;
             break;
         case MRH_EVENT_APP_AVAIL_S:
-            if (e_Service != APPLICATION)
-            {
-                return;
-            }
+            e_Service = APPLICATION;
             break;
             
         default:
             return;
     }
     
+    if ((u32_ServiceMask & (1 << e_Service)) == 0)
+    {
+        return;
+    }
+    
+    c_ServiceCache.SetAvailable(e_Service, c_ServiceAvail.u8_Available == MRH_EVD_BASE_RESULT_SUCCESS);
+    
     if (c_ServiceAvail.u8_Available == MRH_EVD_BASE_RESULT_SUCCESS)
     {
         MRH_ModuleLogger::Singleton().Log("CheckService", "Service " +
                                                           std::to_string(e_Service) +
                                                           " available!",
                                           "CheckService.cpp", __LINE__);
-        e_Result = AVAILABLE;
+        p_Result[e_Service] = AVAILABLE;
     }
     else
     {
@@ -117,15 +147,54 @@ void CheckService::HandleEvent(const MRH_Event* p_Event) noexcept
                                                           std::to_string(e_Service) +
                                                           " not available!",
                                           "CheckService.cpp", __LINE__);
-        e_Result = UNAVAILABLE;
+        p_Result[e_Service] = UNAVAILABLE;
     }
 }
 
 MRH_Module::Result CheckService::Update()
 {
-    if (e_Result != NOT_SET || c_Timer.GetTimerFinished() == true)
+    bool b_Pending = false;
+    
+    for (size_t i = 0; i < SERVICE_COUNT; ++i)
+    {
+        if ((u32_ServiceMask & (1 << i)) == 0)
+        {
+            continue;
+        }
+        
+        // No need to wait for the others
+        if (p_Result[i] == UNAVAILABLE)
+        {
+            b_ServiceAvailable = false;
+            return MRH_Module::FINISHED_POP;
+        }
+        else if (p_Result[i] == NOT_SET)
+        {
+            b_Pending = true;
+        }
+    }
+    
+    if (b_Pending == false)
     {
-        b_ServiceAvailable = (e_Result == AVAILABLE ? true : false);
+        b_ServiceAvailable = true;
+        return MRH_Module::FINISHED_POP;
+    }
+    else if (c_Timer.GetTimerFinished() == true)
+    {
+        for (size_t i = 0; i < SERVICE_COUNT; ++i)
+        {
+            if ((u32_ServiceMask & (1 << i)) != 0 && p_Result[i] == NOT_SET)
+            {
+                MRH_ModuleLogger::Singleton().Log("CheckService", "Service " +
+                                                                  std::to_string(i) +
+                                                                  " did not reply!",
+                                                  "CheckService.cpp", __LINE__);
+                
+                c_ServiceCache.SetAvailable(static_cast<MRH_Uint32>(i), false);
+            }
+        }
+        
+        b_ServiceAvailable = false;
         return MRH_Module::FINISHED_POP;
     }
     
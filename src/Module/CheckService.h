@@ -23,6 +23,7 @@
 #include <libmrhab/Module/MRH_Module.h>
 
 // Project
+#include "../Tools/ServiceCache.h"
 
 
 class CheckService : public MRH_Module
@@ -44,19 +45,37 @@ public:
         SERVICE_COUNT = SERVICE_MAX + 1
     };
     
+    enum ServiceMask
+    {
+        LISTEN_MASK = 1 << LISTEN,
+        SAY_MASK = 1 << SAY,
+        APPLICATION_MASK = 1 << APPLICATION,
+        
+        ALL_MASK = LISTEN_MASK | SAY_MASK | APPLICATION_MASK
+    };
+    
     //*************************************************************************************
     // Constructor / Destructor
     //*************************************************************************************
     
     /**
-     *  Default constructor.
+     *  Default constructor. All services are checked at once, the check 
+     *  finishes on the first unavailable service or once all services 
+     *  replied. Services recently confirmed to be available are not 
+     *  checked again.
      *
-     *  \param e_Service The platform service to check.
-     *  \param b_ServiceAvailable The services available flag to set.
+     *  \param u32_ServiceMask The platform services to check, as a 
+     *                         combination of service masks.
+     *  \param b_ServiceAvailable The services available flag to set. The 
+     *                            flag is only set if all services are 
+     *                            available.
+     *  \param c_ServiceCache The cache to read and update service 
+     *                        availability with.
      */
     
-    CheckService(Service e_Service,
-                 bool& b_ServiceAvailable);
+    CheckService(MRH_Uint32 u32_ServiceMask,
+                 bool& b_ServiceAvailable,
+                 ServiceCache& c_ServiceCache);
     
     /**
      *  Default destructor.
@@ -64,6 +83,20 @@ public:
     
     ~CheckService() noexcept;
     
+    //*************************************************************************************
+    // Reset
+    //*************************************************************************************
+    
+    /**
+     *  Check services again with a unused module. Results are cleared 
+     *  and the timeout restarts.
+     *
+     *  \param u32_ServiceMask The platform services to check, as a 
+     *                         combination of service masks.
+     */
+    
+    void Reset(MRH_Uint32 u32_ServiceMask);
+    
     //*************************************************************************************
     // Update
     //*************************************************************************************
@@ -129,9 +162,10 @@ private:
     
     MRH_ModuleTimer c_Timer;
     
-    Service e_Service;
-    Result e_Result;
+    MRH_Uint32 u32_ServiceMask;
+    Result p_Result[SERVICE_COUNT];
     bool& b_ServiceAvailable;
+    ServiceCache& c_ServiceCache;
     
 protected:
     
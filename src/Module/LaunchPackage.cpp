@@ -37,12 +37,31 @@ LaunchPackage::LaunchPackage(std::string const& s_PackagePath,
                              MRH_Sint32 s32_LaunchCommandID,
                              bool& b_LaunchSet) : MRH_Module("LaunchPackage"),
                                                   c_Timer(MODULE_LAUNCH_PACKAGE_TIMEOUT_MS),
-                                                  s_PackagePath(s_PackagePath),
-                                                  s_LaunchInput(s_LaunchInput),
                                                   s32_LaunchCommandID(s32_LaunchCommandID),
                                                   b_LaunchSet(b_LaunchSet),
                                                   b_AnswerReceived(false)
 {
+    Reset(s_PackagePath, s_LaunchInput, s32_LaunchCommandID);
+}
+
+LaunchPackage::~LaunchPackage() noexcept
+{}
+
+//*************************************************************************************
+// Reset
+//*************************************************************************************
+
+void LaunchPackage::Reset(std::string const& s_PackagePath,
+                          std::string const& s_LaunchInput,
+                          MRH_Sint32 s32_LaunchCommandID)
+{
+    c_Timer = MRH_ModuleTimer(MODULE_LAUNCH_PACKAGE_TIMEOUT_MS);
+    
+    this->s_PackagePath = s_PackagePath;
+    this->s_LaunchInput = s_LaunchInput;
+    this->s32_LaunchCommandID = s32_LaunchCommandID;
+    b_AnswerReceived = false;
+    
     MRH_ModuleLogger::Singleton().Log("LaunchPackage", "Sending launch request: [ " +
                                                        s_PackagePath +
                                                        " | " +
@@ -89,9 +108,6 @@ LaunchPackage::LaunchPackage(std::string const& s_PackagePath,
     }
 }
 
-LaunchPackage::~LaunchPackage() noexcept
-{}
-
 //*************************************************************************************
 // Update
 //*************************************************************************************
@@ -53,6 +53,23 @@ public:
     
     ~LaunchPackage() noexcept;
     
+    //*************************************************************************************
+    // Reset
+    //*************************************************************************************
+    
+    /**
+     *  Send a new launch request with a unused module. The launch result 
+     *  is reset and the timeout restarts.
+     *
+     *  \param s_PackagePath The full path to the package to launch.
+     *  \param s_LaunchInput The input to supply when launching.
+     *  \param s32_LaunchCommandID The launch command id to supply when launching.
+     */
+    
+    void Reset(std::string const& s_PackagePath,
+               std::string const& s_LaunchInput,
+               MRH_Sint32 s32_LaunchCommandID);
+    
     //*************************************************************************************
     // Update
     //*************************************************************************************
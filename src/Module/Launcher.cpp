@@ -15,23 +15,58 @@
  */
 
 // C / C++
+#include <algorithm>
 
 // External
-#include <libmrhvt/Output/MRH_OutputGenerator.h>
-#include <libmrhvt/String/MRH_LocalisedPath.h>
 #include <libmrhvt/String/Compare/MRH_Levenshtein.h>
 
 // Project
 #include "./Launcher.h"
-#include "./CheckService.h"
-#include "./SpeechInput.h"
-#include "./SpeechOutput.h"
-#include "./LaunchPackage.h"
+#include "../Compare/Normalise.h"
 
 // Pre-defined
 #ifndef PACKAGE_LIST_PATH
     #define PACKAGE_LIST_PATH "/usr/local/etc/mrh/MRH_PackageList.conf"
 #endif
+#ifndef PACKAGE_SOURCE_LIST_PATH
+    #define PACKAGE_SOURCE_LIST_PATH "/usr/local/etc/mrh/de.mrh.launcher/PackageSources.conf"
+#endif
+#ifndef PACKAGE_INDEX_PATH
+    #define PACKAGE_INDEX_PATH "Cache/PackageIndex.bin" // In the package FSRoot, like SPEECH_OUTPUT_DIR
+#endif
+#ifndef PACKAGE_LIST_LAZY_LOAD
+    #define PACKAGE_LIST_LAZY_LOAD 0 // Defer package loading and index reads to the first trigger query
+#endif
+#ifndef LAUNCHER_PARALLEL_EVALUATE_MIN
+    #define LAUNCHER_PARALLEL_EVALUATE_MIN 512
+#endif
+#ifndef LAUNCHER_PARALLEL_EVALUATE_SHARDS
+    #define LAUNCHER_PARALLEL_EVALUATE_SHARDS 4
+#endif
+#ifndef LAUNCHER_PARALLEL_EVALUATE_THREAD_MAX
+    #define LAUNCHER_PARALLEL_EVALUATE_THREAD_MAX 4
+#endif
+#ifndef LAUNCHER_SELECTION_CACHE_SIZE
+    #define LAUNCHER_SELECTION_CACHE_SIZE 32
+#endif
+#ifndef LAUNCHER_SELECTION_MAX
+    #define LAUNCHER_SELECTION_MAX 8
+#endif
+#ifndef LAUNCHER_DOMINANT_SIMILARITY
+    #define LAUNCHER_DOMINANT_SIMILARITY 0.15f
+#endif
+#ifndef LAUNCHER_NAME_SIMILARITY
+    #define LAUNCHER_NAME_SIMILARITY 0.75f
+#endif
+#ifndef SERVICE_AVAILABLE_MS
+    #define SERVICE_AVAILABLE_MS 30000
+#endif
+#ifndef SERVICE_BACKOFF_MIN_MS
+    #define SERVICE_BACKOFF_MIN_MS 250
+#endif
+#ifndef SERVICE_BACKOFF_MAX_MS
+    #define SERVICE_BACKOFF_MAX_MS 30000
+#endif
 #ifndef SPEECH_OUTPUT_DIR
     #define SPEECH_OUTPUT_DIR "Output"
 #endif
@@ -42,6 +77,17 @@
     #define SPEECH_OUTPUT_NO_PACKAGE_FILE "NoPackages.mrhog"
 #endif
 
+namespace
+{
+    // Finished modules are released by the module stack, a module 
+    // only held by the launcher is unused
+    template<typename T>
+    bool GetUnused(std::shared_ptr<T> const& p_Module) noexcept
+    {
+        return p_Module != NULL && p_Module.use_count() == 1;
+    }
+}
+
 
 //*************************************************************************************
 // Constructor / Destructor
@@ -52,17 +98,43 @@ Launcher::Launcher() noexcept : MRH_Module("Launcher"),
                                 s_Input(""),
                                 b_LaunchSet(false),
                                 b_ServiceAvailable(false),
-                                c_PackageList(PACKAGE_LIST_PATH)
-{}
+                                c_ServiceCache(SERVICE_AVAILABLE_MS,
+                                               SERVICE_BACKOFF_MIN_MS,
+                                               SERVICE_BACKOFF_MAX_MS),
+                                v_PackageListPath(PackageList::ReadPackageSources(PACKAGE_SOURCE_LIST_PATH,
+                                                                                  PACKAGE_LIST_PATH)),
+                                c_PackageWatch(v_PackageListPath),
+                                s_LaunchInput(""),
+                                s_InputKey(""),
+                                c_SelectionCache(LAUNCHER_SELECTION_CACHE_SIZE)
+{
+    // Load packages while services are checked, the package 
+    // watch was created first and notices list changes during load
+    try
+    {
+        c_PackageLoad = std::async(std::launch::async, &Launcher::LoadPackages, this);
+    }
+    catch (std::exception& e)
+    {
+        MRH_ModuleLogger::Singleton().Log("Launcher", "Failed to start background package load: " +
+                                                      std::string(e.what()),
+                                          "Launcher.cpp", __LINE__);
+        LoadPackages();
+    }
+}
 
 Launcher::~Launcher() noexcept
-{}
+{
+    WaitPackages();
+}
 
-Launcher::Selected::Selected(Package const& c_Package,
-                             std::string const s_LaunchInput,
-                             MRH_Sint32 s32_LaunchCommandID) noexcept : c_Package(c_Package),
-                                                                        s_LaunchInput(s_LaunchInput),
-                                                                        s32_LaunchCommandID(s32_LaunchCommandID)
+Launcher::Selected::Selected(Package::ID u32_PackageID,
+                             MRH_Sint32 s32_LaunchCommandID,
+                             MRH_Uint32 u32_Weight,
+                             float f32_Similarity) noexcept : u32_PackageID(u32_PackageID),
+                                                              s32_LaunchCommandID(s32_LaunchCommandID),
+                                                              u32_Weight(u32_Weight),
+                                                              f32_Similarity(f32_Similarity)
 {}
 
 //*************************************************************************************
@@ -82,7 +154,7 @@ MRH_Module::Result Launcher::Update()
             
         case START:
         {
-            e_State = CHECK_SERVICE_LISTEN;
+            e_State = CHECK_SERVICE;
             return MRH_Module::FINISHED_APPEND;
         }
             
@@ -90,19 +162,15 @@ MRH_Module::Result Launcher::Update()
          *  Check Service
          */
             
-        case CHECK_SERVICE_LISTEN:
-        {
-            e_State = b_ServiceAvailable ? CHECK_SERVICE_SAY : CHECK_SERVICE_LISTEN;
-            return MRH_Module::FINISHED_APPEND;
-        }
-        case CHECK_SERVICE_SAY:
+        case CHECK_SERVICE:
         {
-            e_State = b_ServiceAvailable ? CHECK_SERVICE_APP : CHECK_SERVICE_LISTEN;
-            return MRH_Module::FINISHED_APPEND;
-        }
-        case CHECK_SERVICE_APP:
-        {
-            e_State = b_ServiceAvailable ? INPUT_LAUNCH_TRIGGER : CHECK_SERVICE_LISTEN;
+            // Unavailable services are only checked again after a backoff
+            if (b_ServiceAvailable == false && c_ServiceCache.GetWaitMS(CheckService::ALL_MASK) > 0)
+            {
+                return MRH_Module::IN_PROGRESS;
+            }
+            
+            e_State = b_ServiceAvailable ? INPUT_LAUNCH_TRIGGER : CHECK_SERVICE;
             return MRH_Module::FINISHED_APPEND;
         }
             
@@ -112,6 +180,10 @@ MRH_Module::Result Launcher::Update()
             
         case INPUT_LAUNCH_TRIGGER:
         {
+            // Nothing is selected here, wait for the package load
+            // if still running and apply package changes
+            UpdatePackages();
+            
             // No input
             if (s_Input.size() == 0)
             {
@@ -187,7 +259,10 @@ MRH_Module::Result Launcher::Update()
         {
             if (b_LaunchSet == false)
             {
-                e_State = CHECK_SERVICE_LISTEN; // Failed, check services again
+                // Failed, the application service might be gone
+                c_ServiceCache.Invalidate(CheckService::APPLICATION);
+                
+                e_State = CHECK_SERVICE; // Check services again
                 return MRH_Module::FINISHED_APPEND;
             }
             else
@@ -216,36 +291,22 @@ std::shared_ptr<MRH_Module> Launcher::NextModule()
          *  Check Service
          */
             
-        case CHECK_SERVICE_LISTEN:
-        {
-            try
-            {
-                return std::make_shared<CheckService>(CheckService::LISTEN,
-                                                      b_ServiceAvailable);
-            }
-            catch (MRH_ModuleException& e)
-            {
-                throw;
-            }
-        }
-        case CHECK_SERVICE_SAY:
-        {
-            try
-            {
-                return std::make_shared<CheckService>(CheckService::SAY,
-                                                      b_ServiceAvailable);
-            }
-            catch (MRH_ModuleException& e)
-            {
-                throw;
-            }
-        }
-        case CHECK_SERVICE_APP:
+        case CHECK_SERVICE:
         {
             try
             {
-                return std::make_shared<CheckService>(CheckService::APPLICATION,
-                                                      b_ServiceAvailable);
+                if (GetUnused(p_CheckService) == true)
+                {
+                    p_CheckService->Reset(CheckService::ALL_MASK);
+                }
+                else
+                {
+                    p_CheckService = std::make_shared<CheckService>(CheckService::ALL_MASK,
+                                                                    b_ServiceAvailable,
+                                                                    c_ServiceCache);
+                }
+                
+                return p_CheckService;
             }
             catch (MRH_ModuleException& e)
             {
@@ -260,7 +321,17 @@ std::shared_ptr<MRH_Module> Launcher::NextModule()
         case INPUT_LAUNCH_TRIGGER:
         case INPUT_PACKAGE_NAME:
         {
-            return std::make_shared<SpeechInput>(s_Input);
+            // Reused for every listen timeout without allocating
+            if (GetUnused(p_SpeechInput) == true)
+            {
+                p_SpeechInput->Reset();
+            }
+            else
+            {
+                p_SpeechInput = std::make_shared<SpeechInput>(s_Input);
+            }
+            
+            return p_SpeechInput;
         }
             
         /**
@@ -271,7 +342,7 @@ std::shared_ptr<MRH_Module> Launcher::NextModule()
         {
             try
             {
-                return std::make_shared<SpeechOutput>(PackageListOutput());
+                return GetSpeechOutput(PackageListOutput());
             }
             catch (MRH_ModuleException& e)
             {
@@ -282,7 +353,7 @@ std::shared_ptr<MRH_Module> Launcher::NextModule()
         {
             try
             {
-                return std::make_shared<SpeechOutput>(NoPackagesOutput());
+                return GetSpeechOutput(NoPackagesOutput());
             }
             catch (MRH_ModuleException& e)
             {
@@ -305,10 +376,23 @@ std::shared_ptr<MRH_Module> Launcher::NextModule()
                 }
                 
                 auto& Selected = l_Selected.front();
-                return std::make_shared<LaunchPackage>(Selected.c_Package.GetPackagePath(),
-                                                       Selected.s_LaunchInput,
-                                                       Selected.s32_LaunchCommandID,
-                                                       b_LaunchSet);
+                std::string s_PackagePath(p_PackageList->GetPackage(Selected.u32_PackageID).GetPackagePath());
+                
+                if (GetUnused(p_LaunchPackage) == true)
+                {
+                    p_LaunchPackage->Reset(s_PackagePath,
+                                           s_LaunchInput,
+                                           Selected.s32_LaunchCommandID);
+                }
+                else
+                {
+                    p_LaunchPackage = std::make_shared<LaunchPackage>(s_PackagePath,
+                                                                      s_LaunchInput,
+                                                                      Selected.s32_LaunchCommandID,
+                                                                      b_LaunchSet);
+                }
+                
+                return p_LaunchPackage;
             }
             catch (MRH_ModuleException& e)
             {
@@ -332,41 +416,112 @@ std::shared_ptr<MRH_Module> Launcher::NextModule()
 // Package
 //*************************************************************************************
 
+void Launcher::LoadPackages() noexcept
+{
+    p_PackageList = std::make_unique<PackageList>(v_PackageListPath,
+                                                  PACKAGE_INDEX_PATH,
+                                                  PACKAGE_LIST_LAZY_LOAD != 0);
+    c_PackageWatch.SetPackages(p_PackageList->GetPackagePaths(), {});
+}
+
+void Launcher::WaitPackages() noexcept
+{
+    if (c_PackageLoad.valid() == false)
+    {
+        return;
+    }
+    
+    if (c_PackageLoad.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        MRH_ModuleLogger::Singleton().Log("Launcher", "Waiting for package list load...",
+                                          "Launcher.cpp", __LINE__);
+    }
+    
+    c_PackageLoad.get();
+}
+
+void Launcher::UpdatePackages() noexcept
+{
+    WaitPackages();
+    
+    PackageWatch::Changes c_Changes = c_PackageWatch.GetChanges();
+    
+    if (c_Changes.b_ListChanged == false && c_Changes.s_Changed.size() == 0)
+    {
+        return;
+    }
+    
+    // Selected package ids might be removed
+    l_Selected.clear();
+    c_SelectionCache.Clear();
+    
+    p_PackageList->Update(c_Changes.b_ListChanged, c_Changes.s_Changed);
+    c_PackageWatch.SetPackages(p_PackageList->GetPackagePaths(), c_Changes.s_Changed);
+}
+
 void Launcher::SelectPackageLaunchTrigger() noexcept
 {
-    std::list<Package> const& l_Package = c_PackageList.GetPackages();
-    MRH_InputTrigger::Evaluation c_Current(-1, 0);
+    MRH_ModuleLogger& c_Logger = MRH_ModuleLogger::Singleton();
+    SelectionCache::Selection v_Selection;
     
-    for (auto& Package : l_Package)
+    l_Selected.clear();
+    s_LaunchInput = s_Input;
+    
+    // Normalise once, all triggers are compared with the normalised input
+    try
     {
-        // Evaluate with trigger
-        MRH_InputTrigger::Evaluation c_Next = Package.GetLaunchTrigger().Evaluate(s_Input, 1);
-        
-        if (c_Next.first < 0 || c_Next.second < c_Current.second)
+        s_InputKey = Normalise::String(s_Input);
+    }
+    catch (std::exception& e)
+    {
+        c_Logger.Log("Launcher", "Failed to normalise input: " +
+                                 std::string(e.what()),
+                     "Launcher.cpp", __LINE__);
+        s_InputKey = s_Input;
+    }
+    
+    // Repeated inputs select the same packages until packages change
+    if (c_SelectionCache.Get(s_InputKey, v_Selection) == true)
+    {
+        for (auto& Selected : v_Selection)
         {
-            // Invalid, do not use
-            continue;
+            l_Selected.emplace_back(Selected.first,
+                                    Selected.second.s32_Value,
+                                    Selected.second.u32_Weight,
+                                    Selected.second.f32_Similarity);
         }
+    }
+    else
+    {
+        EvaluateLaunchTrigger();
+        SelectDominantPackage();
         
-        // New highest weight?
-        if (c_Next.second > c_Current.second)
+        try
         {
-            // Highest weight, replace old
-            l_Selected.clear();
+            for (auto& Selected : l_Selected)
+            {
+                v_Selection.emplace_back(Selected.u32_PackageID,
+                                         TriggerTable::Evaluation(Selected.s32_LaunchCommandID,
+                                                                  Selected.u32_Weight,
+                                                                  Selected.f32_Similarity));
+            }
             
-            // New highest
-            c_Current = c_Next;
+            c_SelectionCache.Set(s_InputKey, v_Selection);
         }
-        
-        // Can be added
-        l_Selected.emplace_back(Package,
-                                s_Input,
-                                c_Current.first);
+        catch (...)
+        {}
     }
     
-    // List matching
-    MRH_ModuleLogger& c_Logger = MRH_ModuleLogger::Singleton();
+    c_Logger.Log("Launcher", "Selection cache: " +
+                             std::to_string(c_SelectionCache.GetHitCount()) +
+                             " hits, " +
+                             std::to_string(c_SelectionCache.GetMissCount()) +
+                             " misses, " +
+                             std::to_string(c_SelectionCache.GetSize()) +
+                             " cached",
+                 "Launcher.cpp", __LINE__);
     
+    // List matching
     if (l_Selected.size() > 0)
     {
         c_Logger.Log("Launcher", "Selected packages by trigger for input " +
@@ -376,9 +531,13 @@ void Launcher::SelectPackageLaunchTrigger() noexcept
         
         for (auto& Selected : l_Selected)
         {
-            c_Logger.Log("Launcher", Selected.c_Package.GetPackagePath() +
+            c_Logger.Log("Launcher", std::string(p_PackageList->GetPackage(Selected.u32_PackageID).GetPackagePath()) +
                                      " (Command: " +
                                      std::to_string(Selected.s32_LaunchCommandID) +
+                                     ", Weight: " +
+                                     std::to_string(Selected.u32_Weight) +
+                                     ", Similarity: " +
+                                     std::to_string(Selected.f32_Similarity) +
                                      ")",
                          "Launcher.cpp", __LINE__);
         }
@@ -390,20 +549,237 @@ void Launcher::SelectPackageLaunchTrigger() noexcept
     }
 }
 
+void Launcher::EvaluateLaunchTrigger() noexcept
+{
+    TriggerTable const& c_Table = p_PackageList->GetTriggerTable();
+    std::vector<TriggerRanking::Candidate> v_Ranked;
+    
+    try
+    {
+        TriggerRanking c_Ranking(LAUNCHER_SELECTION_MAX);
+        
+        // Equal triggers decide the selection if no other trigger reaches 
+        // their weight, otherwise lower weights can be skipped
+        TriggerHash::Entry const* p_Equal = p_PackageList->GetTriggerHash().Find(s_InputKey);
+        MRH_Uint32 u32_MinWeight = 0;
+        
+        if (p_Equal != NULL && p_Equal->b_Decisive == true)
+        {
+            for (MRH_Uint32 i = p_Equal->u32_HitStart; i < p_Equal->u32_HitEnd; ++i)
+            {
+                TriggerHash::Hit const& c_Hit = p_PackageList->GetTriggerHash().GetHit(i);
+                
+                c_Ranking.Add(TriggerRanking::Candidate(c_Hit.u32_Position,
+                                                        c_Table.GetPackageID(c_Hit.u32_Position),
+                                                        TriggerTable::Evaluation(c_Hit.s32_Value, p_Equal->u32_Weight, 1.f)));
+            }
+        }
+        else
+        {
+            if (p_Equal != NULL)
+            {
+                u32_MinWeight = p_Equal->u32_Weight;
+            }
+            
+            EvaluateRanking(c_Table, u32_MinWeight, c_Ranking);
+        }
+        
+        c_Ranking.GetCandidates(v_Ranked);
+    }
+    catch (std::exception& e)
+    {
+        MRH_ModuleLogger::Singleton().Log("Launcher", "Failed to rank packages: " +
+                                                      std::string(e.what()),
+                                          "Launcher.cpp", __LINE__);
+        return;
+    }
+    
+    // Lower weights are only ranked to fill the heap
+    for (auto& Candidate : v_Ranked)
+    {
+        if (Candidate.c_Evaluation.u32_Weight < v_Ranked.front().c_Evaluation.u32_Weight)
+        {
+            break;
+        }
+        
+        l_Selected.emplace_back(Candidate.u32_PackageID,
+                                v_Ranked.front().c_Evaluation.s32_Value,
+                                Candidate.c_Evaluation.u32_Weight,
+                                Candidate.c_Evaluation.f32_Similarity);
+    }
+}
+
+void Launcher::EvaluateRanking(TriggerTable const& c_Table,
+                               MRH_Uint32 u32_MinWeight,
+                               TriggerRanking& c_Ranking)
+{
+    // Only packages which might match are evaluated
+    bool b_Filtered = true;
+    
+    try
+    {
+        p_PackageList->GetCandidates(s_InputKey, v_Candidate);
+    }
+    catch (std::exception& e)
+    {
+        MRH_ModuleLogger::Singleton().Log("Launcher", "Failed to filter packages: " +
+                                                      std::string(e.what()),
+                                          "Launcher.cpp", __LINE__);
+        b_Filtered = false;
+    }
+    
+    size_t us_Count = (b_Filtered == true ? v_Candidate.size() : c_Table.GetPackageCount());
+    WorkerPool* p_Pool = (us_Count >= LAUNCHER_PARALLEL_EVALUATE_MIN ? GetEvaluatePool() : NULL);
+    
+    if (p_Pool == NULL)
+    {
+        EvaluatePackages(c_Table, b_Filtered, u32_MinWeight, 0, us_Count, c_Ranking);
+        return;
+    }
+    
+    // Split into more shards than threads, early rejects make 
+    // shard costs uneven
+    size_t us_ShardCount = (p_Pool->GetThreadCount() + 1) * LAUNCHER_PARALLEL_EVALUATE_SHARDS;
+    size_t us_ShardSize = (us_Count + us_ShardCount - 1) / us_ShardCount;
+    us_ShardCount = (us_Count + us_ShardSize - 1) / us_ShardSize;
+    
+    std::vector<TriggerRanking> v_ShardRanking;
+    
+    try
+    {
+        v_ShardRanking.reserve(us_ShardCount);
+        
+        for (size_t i = 0; i < us_ShardCount; ++i)
+        {
+            v_ShardRanking.emplace_back(LAUNCHER_SELECTION_MAX);
+        }
+    }
+    catch (...)
+    {
+        EvaluatePackages(c_Table, b_Filtered, u32_MinWeight, 0, us_Count, c_Ranking);
+        return;
+    }
+    
+    p_Pool->Run(us_ShardCount, [&](size_t us_Shard)
+    {
+        EvaluatePackages(c_Table,
+                         b_Filtered,
+                         u32_MinWeight,
+                         us_Shard * us_ShardSize,
+                         std::min(us_Count, (us_Shard + 1) * us_ShardSize),
+                         v_ShardRanking[us_Shard]);
+    });
+    
+    // Every package ranked overall is ranked within its shard, the 
+    // table position keeps the order equal to serial evaluation
+    for (auto& Ranking : v_ShardRanking)
+    {
+        c_Ranking.Add(Ranking);
+    }
+}
+
+void Launcher::EvaluatePackages(TriggerTable const& c_Table,
+                                bool b_Filtered,
+                                MRH_Uint32 u32_MinWeight,
+                                size_t us_Begin,
+                                size_t us_End,
+                                TriggerRanking& c_Result) const noexcept
+{
+    for (size_t j = us_Begin; j < us_End; ++j)
+    {
+        size_t i = (b_Filtered == true ? v_Candidate[j] : j);
+        
+        // Evaluate with trigger
+        c_Result.Add(TriggerRanking::Candidate(i,
+                                               c_Table.GetPackageID(i),
+                                               c_Table.Evaluate(i, s_InputKey, u32_MinWeight)));
+    }
+}
+
+void Launcher::SelectDominantPackage() noexcept
+{
+    if (l_Selected.size() < 2)
+    {
+        return;
+    }
+    
+    // Selected packages share the weight and are ranked by similarity
+    float f32_Margin = l_Selected.front().f32_Similarity - (++(l_Selected.begin()))->f32_Similarity;
+    
+    if (f32_Margin < LAUNCHER_DOMINANT_SIMILARITY)
+    {
+        return;
+    }
+    
+    MRH_ModuleLogger::Singleton().Log("Launcher", std::string(p_PackageList->GetPackage(l_Selected.front().u32_PackageID).GetPackagePath()) +
+                                                  " dominates the selection, skipping package list",
+                                      "Launcher.cpp", __LINE__);
+    
+    l_Selected.erase(++(l_Selected.begin()), l_Selected.end());
+}
+
+WorkerPool* Launcher::GetEvaluatePool() noexcept
+{
+    if (p_EvaluatePool != NULL)
+    {
+        return p_EvaluatePool.get();
+    }
+    
+    // Evaluations are split into at least one shard per thread
+    size_t us_WorkerCount = WorkerPool::GetWorkerCount(LAUNCHER_PARALLEL_EVALUATE_THREAD_MAX,
+                                                       LAUNCHER_PARALLEL_EVALUATE_THREAD_MAX);
+    
+    if (us_WorkerCount == 0)
+    {
+        return NULL;
+    }
+    
+    try
+    {
+        p_EvaluatePool = std::make_unique<WorkerPool>(us_WorkerCount);
+    }
+    catch (std::exception& e)
+    {
+        MRH_ModuleLogger::Singleton().Log("Launcher", "Failed to create evaluation pool: " +
+                                                      std::string(e.what()),
+                                          "Launcher.cpp", __LINE__);
+        return NULL;
+    }
+    
+    return p_EvaluatePool.get();
+}
+
 void Launcher::FilterPackageByName() noexcept
 {
     MRH_ModuleLogger& c_Logger = MRH_ModuleLogger::Singleton();
+    NameIndex const& c_NameIndex = p_PackageList->GetNameIndex();
     bool b_Match;
     
     for (auto It = l_Selected.begin(); It != l_Selected.end();)
     {
-        b_Match = MRH_StringCompareLS::ContainedIn(It->c_Package.GetApplicationName(),
-                                                   s_Input,
-                                                   0.75f);
+        Package const& c_Package = p_PackageList->GetPackage(It->u32_PackageID);
+        
+        // Reject by shared trigrams first, the containment check has to 
+        // compare every part of the input
+        try
+        {
+            b_Match = c_NameIndex.GetCandidate(It->u32_PackageID, s_Input, LAUNCHER_NAME_SIMILARITY);
+        }
+        catch (...)
+        {
+            b_Match = true;
+        }
+        
+        if (b_Match == true)
+        {
+            b_Match = MRH_StringCompareLS::ContainedIn(std::string(c_Package.GetApplicationName()),
+                                                       s_Input,
+                                                       LAUNCHER_NAME_SIMILARITY);
+        }
         
         if (b_Match == false)
         {
-            c_Logger.Log("Launcher", It->c_Package.GetPackagePath() +
+            c_Logger.Log("Launcher", std::string(c_Package.GetPackagePath()) +
                                      " removed, name mismatch with input " +
                                      s_Input,
                          "Launcher.cpp", __LINE__);
@@ -421,12 +797,26 @@ void Launcher::FilterPackageByName() noexcept
 // Output
 //*************************************************************************************
 
+std::shared_ptr<MRH_Module> Launcher::GetSpeechOutput(std::string const& s_Output)
+{
+    if (GetUnused(p_SpeechOutput) == true)
+    {
+        p_SpeechOutput->Reset(s_Output);
+    }
+    else
+    {
+        p_SpeechOutput = std::make_shared<SpeechOutput>(s_Output);
+    }
+    
+    return p_SpeechOutput;
+}
+
 std::string Launcher::NoPackagesOutput()
 {
     try
     {
-        return MRH_OutputGenerator(MRH_LocalisedPath::GetPath(SPEECH_OUTPUT_DIR, 
-                                                              SPEECH_OUTPUT_NO_PACKAGE_FILE)).Generate();
+        return c_OutputCache.Generate(SPEECH_OUTPUT_DIR,
+                                      SPEECH_OUTPUT_NO_PACKAGE_FILE);
     }
     catch (std::exception& e)
     {
@@ -439,13 +829,13 @@ std::string Launcher::PackageListOutput()
 {
     try
     {
-        std::string s_PackageList = MRH_OutputGenerator(MRH_LocalisedPath::GetPath(SPEECH_OUTPUT_DIR,
-                                                                                   SPEECH_OUTPUT_LIST_PACKAGE_FILE)).Generate();
+        std::string s_PackageList = c_OutputCache.Generate(SPEECH_OUTPUT_DIR,
+                                                           SPEECH_OUTPUT_LIST_PACKAGE_FILE);
         s_PackageList += " ";
         
         for (auto It = l_Selected.begin(); It != l_Selected.end(); ++It)
         {
-            s_PackageList += It->c_Package.GetApplicationName();
+            s_PackageList += p_PackageList->GetPackage(It->u32_PackageID).GetApplicationName();
             
             if (It != (--(l_Selected.end())))
             {
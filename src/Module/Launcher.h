@@ -18,12 +18,24 @@
 #define Launcher_h
 
 // C / C++
+#include <future>
+#include <memory>
 
 // External
 #include <libmrhab/Module/MRH_Module.h>
 
 // Project
+#include "./CheckService.h"
+#include "./SpeechInput.h"
+#include "./SpeechOutput.h"
+#include "./LaunchPackage.h"
 #include "../Package/PackageList.h"
+#include "../Package/PackageWatch.h"
+#include "../Package/SelectionCache.h"
+#include "../Package/TriggerRanking.h"
+#include "../Tools/WorkerPool.h"
+#include "../Tools/ServiceCache.h"
+#include "../Tools/OutputCache.h"
 
 
 class Launcher : public MRH_Module
@@ -105,31 +117,32 @@ private:
         /**
          *  Default constructor.
          *  
-         *  \param c_Package The selected package.
-         *  \param s_LaunchInput The input used for launch.
+         *  \param u32_PackageID The selected package id.
          *  \param s32_LaunchCommandID The chosen launch command id.
+         *  \param u32_Weight The weight of the matching trigger.
+         *  \param f32_Similarity The similarity of the matching trigger and the input.
          */
         
-        Selected(Package const& c_Package,
-                 std::string const s_LaunchInput,
-                 MRH_Sint32 s32_LaunchCommandID) noexcept;
+        Selected(Package::ID u32_PackageID,
+                 MRH_Sint32 s32_LaunchCommandID,
+                 MRH_Uint32 u32_Weight,
+                 float f32_Similarity) noexcept;
         
         //*************************************************************************************
         // Data
         //*************************************************************************************
         
-        Package const& c_Package;
-        std::string s_LaunchInput;
+        Package::ID u32_PackageID;
         MRH_Sint32 s32_LaunchCommandID;
+        MRH_Uint32 u32_Weight;
+        float f32_Similarity;
     };
     
     enum State
     {
         START = 0,
         
-        CHECK_SERVICE_LISTEN = 1,
-        CHECK_SERVICE_SAY = 2,
-        CHECK_SERVICE_APP = 3,
+        CHECK_SERVICE = 1, // Check all services at once
         
         INPUT_LAUNCH_TRIGGER = 4, // Listen for launch triggers
         INPUT_PACKAGE_NAME = 6, // Check package name
@@ -151,11 +164,89 @@ private:
     //*************************************************************************************
     
     /**
-     *  Select packages by launch trigger.
+     *  Load the package list and watch the listed packages. Used 
+     *  by the background package load.
+     */
+    
+    void LoadPackages() noexcept;
+    
+    /**
+     *  Wait for the background package load to finish. Returns 
+     *  immediately once the package list is loaded.
+     */
+    
+    void WaitPackages() noexcept;
+    
+    /**
+     *  Apply all package changes since the last update. Selected 
+     *  packages are cleared if packages changed.
+     */
+    
+    void UpdatePackages() noexcept;
+    
+    /**
+     *  Select packages by launch trigger. Cached selections are used 
+     *  for repeated inputs.
      */
     
     void SelectPackageLaunchTrigger() noexcept;
     
+    /**
+     *  Select packages by evaluating the launch triggers of all packages 
+     *  which might match. The best ranked packages with the highest weight 
+     *  are selected, the best ranked package sets the launch command.
+     */
+    
+    void EvaluateLaunchTrigger() noexcept;
+    
+    /**
+     *  Rank all packages which might match by launch trigger. Large 
+     *  candidate sets are evaluated in parallel.
+     *
+     *  \param c_Table The trigger table to evaluate.
+     *  \param u32_MinWeight The lowest trigger weight to evaluate.
+     *  \param c_Ranking The ranking to add the matching packages to.
+     */
+    
+    void EvaluateRanking(TriggerTable const& c_Table,
+                         MRH_Uint32 u32_MinWeight,
+                         TriggerRanking& c_Ranking);
+    
+    /**
+     *  Evaluate a range of packages by launch trigger.
+     *
+     *  \param c_Table The trigger table to evaluate.
+     *  \param b_Filtered If the range refers to candidates instead of 
+     *                    trigger table positions.
+     *  \param u32_MinWeight The lowest trigger weight to evaluate.
+     *  \param us_Begin The first index of the range.
+     *  \param us_End The index after the last index of the range.
+     *  \param c_Result The ranking to add the matching packages to.
+     */
+    
+    void EvaluatePackages(TriggerTable const& c_Table,
+                          bool b_Filtered,
+                          MRH_Uint32 u32_MinWeight,
+                          size_t us_Begin,
+                          size_t us_End,
+                          TriggerRanking& c_Result) const noexcept;
+    
+    /**
+     *  Keep only the best ranked selected package if its similarity is 
+     *  clearly higher than the similarity of all others.
+     */
+    
+    void SelectDominantPackage() noexcept;
+    
+    /**
+     *  Get the worker pool for parallel package evaluation. The pool is 
+     *  created on first use.
+     *
+     *  \return The worker pool or NULL if evaluation should be serial.
+     */
+    
+    WorkerPool* GetEvaluatePool() noexcept;
+    
     /**
      *  Filter selected packages by application name.
      */
@@ -166,6 +257,16 @@ private:
     // Output
     //*************************************************************************************
     
+    /**
+     *  Get a speech output module. A unused module is reused.
+     *
+     *  \param s_Output The string to perform as speech output.
+     *
+     *  \return The speech output module.
+     */
+    
+    std::shared_ptr<MRH_Module> GetSpeechOutput(std::string const& s_Output);
+    
     /**
      *  Generate no packages output.
      *  
@@ -191,12 +292,30 @@ private:
 
     // Module information
     bool b_ServiceAvailable;
+    ServiceCache c_ServiceCache; // Kept across service checks
     std::string s_Input;
     bool b_LaunchSet;
     
-    // Packages
-    PackageList c_PackageList;
+    // Packages, loaded in the background until first used
+    std::vector<std::string> v_PackageListPath;
+    std::unique_ptr<PackageList> p_PackageList;
+    PackageWatch c_PackageWatch;
+    std::future<void> c_PackageLoad;
     std::list<Selected> l_Selected;
+    std::string s_LaunchInput; // Input used for launch, shared by all selected
+    std::string s_InputKey; // Normalised input, used for trigger evaluation
+    std::vector<size_t> v_Candidate; // Trigger table positions to evaluate
+    std::unique_ptr<WorkerPool> p_EvaluatePool;
+    SelectionCache c_SelectionCache; // Cleared on package changes
+    
+    // Modules, reused once released by the module stack
+    std::shared_ptr<CheckService> p_CheckService;
+    std::shared_ptr<SpeechInput> p_SpeechInput;
+    std::shared_ptr<SpeechOutput> p_SpeechOutput;
+    std::shared_ptr<LaunchPackage> p_LaunchPackage;
+    
+    // Parsed output files, kept until changed
+    OutputCache c_OutputCache;
     
 protected:
 
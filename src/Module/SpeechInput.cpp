@@ -42,6 +42,17 @@ SpeechInput::SpeechInput(std::string& s_Input) noexcept : MRH_Module("SpeechInpu
 SpeechInput::~SpeechInput() noexcept
 {}
 
+//*************************************************************************************
+// Reset
+//*************************************************************************************
+
+void SpeechInput::Reset() noexcept
+{
+    // Keeps the input capacity, the listen loop does not allocate
+    c_Timer = MRH_ModuleTimer(SPEECH_INPUT_TIMEOUT_MS);
+    s_Input.clear();
+}
+
 //*************************************************************************************
 // Update
 //*************************************************************************************
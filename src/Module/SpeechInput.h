@@ -47,6 +47,17 @@ public:
     
     ~SpeechInput() noexcept;
     
+    //*************************************************************************************
+    // Reset
+    //*************************************************************************************
+    
+    /**
+     *  Restart listening with a unused module. The input is cleared and 
+     *  the timeout restarts.
+     */
+    
+    void Reset() noexcept;
+    
     //*************************************************************************************
     // Update
     //*************************************************************************************
@@ -34,9 +34,25 @@
 
 SpeechOutput::SpeechOutput(std::string s_Output) : MRH_Module("SpeechOutput"),
                                                    c_Timer(SPEECH_OUTPUT_TIMEOUT_MS),
-                                                   u32_SentOutputID((rand() % ((MRH_Uint32) - 1)) + 1),
+                                                   u32_SentOutputID(0),
                                                    u32_ReceivedOutputID(0)
 {
+    Reset(s_Output);
+}
+
+SpeechOutput::~SpeechOutput() noexcept
+{}
+
+//*************************************************************************************
+// Reset
+//*************************************************************************************
+
+void SpeechOutput::Reset(std::string const& s_Output)
+{
+    c_Timer = MRH_ModuleTimer(SPEECH_OUTPUT_TIMEOUT_MS);
+    u32_SentOutputID = (rand() % ((MRH_Uint32) - 1)) + 1;
+    u32_ReceivedOutputID = 0;
+    
     MRH_ModuleLogger::Singleton().Log("SpeechOutput", "Sending output: " +
                                                       s_Output +
                                                       " (ID: " +
@@ -72,9 +88,6 @@ SpeechOutput::SpeechOutput(std::string s_Output) : MRH_Module("SpeechOutput"),
     }
 }
 
-SpeechOutput::~SpeechOutput() noexcept
-{}
-
 //*************************************************************************************
 // Update
 //*************************************************************************************
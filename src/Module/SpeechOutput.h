@@ -47,6 +47,19 @@ public:
     
     ~SpeechOutput() noexcept;
     
+    //*************************************************************************************
+    // Reset
+    //*************************************************************************************
+    
+    /**
+     *  Perform new speech output with a unused module. The timeout 
+     *  restarts.
+     *
+     *  \param s_Output The string to perform as speech output.
+     */
+    
+    void Reset(std::string const& s_Output);
+    
     //*************************************************************************************
     // Update
     //*************************************************************************************
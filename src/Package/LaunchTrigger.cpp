@@ -0,0 +1,123 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+
+// External
+#include <libmrhbf.h>
+#include <libmrhvt/Error/MRH_VTException.h>
+
+// Project
+#include "./LaunchTrigger.h"
+
+// Pre-defined
+namespace
+{
+    const char* p_CompareMethodBlock = "CompareMethod";
+    const char* p_CompareMethodIdentifierKey = "Identifier";
+    const char* p_CompareMethodSimilarityKey = "LS_Similarity";
+    
+    const char* p_TriggerBlock = "Trigger";
+    const char* p_TriggerStringKey = "String";
+    const char* p_TriggerWeightKey = "Weight";
+    const char* p_TriggerValueKey = "Value";
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+LaunchTrigger::LaunchTrigger() noexcept : e_CompareMethod(EXACT),
+                                          f32_Similarity(1.f)
+{}
+
+LaunchTrigger::LaunchTrigger(std::string const& s_FilePath) : e_CompareMethod(EXACT),
+                                                              f32_Similarity(1.f)
+{
+    try
+    {
+        MRH_BlockFile c_File(s_FilePath);
+        
+        for (auto& Block : c_File.l_Block)
+        {
+            if (Block.GetName().compare(p_CompareMethodBlock) == 0)
+            {
+                MRH_Uint32 u32_Method = static_cast<MRH_Uint32>(std::stoul(Block.GetValue(p_CompareMethodIdentifierKey)));
+                
+                if (u32_Method > COMPARE_METHOD_MAX)
+                {
+                    throw MRH_VTException("Unknown compare method!");
+                }
+                
+                e_CompareMethod = static_cast<CompareMethod>(u32_Method);
+                
+                if (e_CompareMethod == LEVENSHTEIN)
+                {
+                    f32_Similarity = std::stof(Block.GetValue(p_CompareMethodSimilarityKey));
+                }
+            }
+            else if (Block.GetName().compare(p_TriggerBlock) == 0)
+            {
+                v_Trigger.push_back({ Block.GetValue(p_TriggerStringKey),
+                                      static_cast<MRH_Uint32>(std::stoul(Block.GetValue(p_TriggerWeightKey))),
+                                      static_cast<MRH_Sint32>(std::stol(Block.GetValue(p_TriggerValueKey))) });
+            }
+        }
+    }
+    catch (MRH_VTException& e)
+    {
+        throw;
+    }
+    catch (std::exception& e)
+    {
+        throw MRH_VTException("Invalid launch trigger: " + std::string(e.what()));
+    }
+    
+    if (v_Trigger.size() == 0)
+    {
+        throw MRH_VTException("No launch triggers defined!");
+    }
+}
+
+LaunchTrigger::LaunchTrigger(CompareMethod e_CompareMethod,
+                             float f32_Similarity,
+                             std::vector<Trigger> v_Trigger) noexcept : e_CompareMethod(e_CompareMethod),
+                                                                        f32_Similarity(f32_Similarity),
+                                                                        v_Trigger(std::move(v_Trigger))
+{}
+
+LaunchTrigger::~LaunchTrigger() noexcept
+{}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+LaunchTrigger::CompareMethod LaunchTrigger::GetCompareMethod() const noexcept
+{
+    return e_CompareMethod;
+}
+
+float LaunchTrigger::GetSimilarity() const noexcept
+{
+    return f32_Similarity;
+}
+
+std::vector<LaunchTrigger::Trigger> const& LaunchTrigger::GetTriggers() const noexcept
+{
+    return v_Trigger;
+}
@@ -0,0 +1,143 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LaunchTrigger_h
+#define LaunchTrigger_h
+
+// C / C++
+#include <string>
+#include <vector>
+
+// External
+#include <MRH_Typedefs.h>
+
+// Project
+
+
+class LaunchTrigger
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    enum CompareMethod
+    {
+        EXACT = 0,
+        LEVENSHTEIN = 1,
+        
+        COMPARE_METHOD_MAX = LEVENSHTEIN,
+        
+        COMPARE_METHOD_COUNT = COMPARE_METHOD_MAX + 1
+    };
+    
+    struct Trigger
+    {
+    public:
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        std::string s_String;
+        MRH_Uint32 u32_Weight;
+        MRH_Sint32 s32_Value;
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor. No triggers are defined.
+     */
+    
+    LaunchTrigger() noexcept;
+    
+    /**
+     *  File constructor. The .mrhit block file is read in place of 
+     *  MRH_InputTrigger, which does not expose its triggers. The compare 
+     *  method identifier has to be 0 (exact) or 1 (Levenshtein with 
+     *  LS_Similarity), other identifiers are rejected. Build with 
+     *  LAUNCH_TRIGGER_VERIFY to log differences to MRH_InputTrigger.
+     *
+     *  \param s_FilePath The full path to the launch trigger file.
+     */
+    
+    LaunchTrigger(std::string const& s_FilePath);
+    
+    /**
+     *  Data constructor.
+     *
+     *  \param e_CompareMethod The compare method to use.
+     *  \param f32_Similarity The required similarity for a match.
+     *  \param v_Trigger The triggers to use.
+     */
+    
+    LaunchTrigger(CompareMethod e_CompareMethod,
+                  float f32_Similarity,
+                  std::vector<Trigger> v_Trigger) noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~LaunchTrigger() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the compare method.
+     *
+     *  \return The compare method.
+     */
+    
+    CompareMethod GetCompareMethod() const noexcept;
+    
+    /**
+     *  Get the required similarity for a match.
+     *
+     *  \return The required similarity.
+     */
+    
+    float GetSimilarity() const noexcept;
+    
+    /**
+     *  Get all triggers.
+     *
+     *  \return The triggers.
+     */
+    
+    std::vector<Trigger> const& GetTriggers() const noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    CompareMethod e_CompareMethod;
+    float f32_Similarity;
+    std::vector<Trigger> v_Trigger;
+    
+protected:
+    
+};
+
+#endif /* LaunchTrigger_h */
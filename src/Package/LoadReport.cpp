@@ -0,0 +1,234 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <algorithm>
+#include <fstream>
+#include <cstdio>
+
+// External
+#include <libmrhab/Module/Tools/MRH_ModuleLogger.h>
+
+// Project
+#include "./LoadReport.h"
+
+namespace
+{
+    std::string ToMS(MRH_Uint64 u64_NS) noexcept
+    {
+        char p_Buffer[32];
+        std::snprintf(p_Buffer, sizeof(p_Buffer), "%.3f ms", static_cast<double>(u64_NS) / 1000000.0);
+        
+        return p_Buffer;
+    }
+    
+    std::string GetSteps(Package::LoadTime const& c_LoadTime) noexcept
+    {
+        return "path " +
+               ToMS(c_LoadTime.u64_PathNS) +
+               ", trigger " +
+               ToMS(c_LoadTime.u64_TriggerNS) +
+               ", name " +
+               ToMS(c_LoadTime.u64_NameNS);
+    }
+    
+    std::string GetCSVField(std::string const& s_Field)
+    {
+        // Paths may contain separators and quotes
+        std::string s_Result = "\"";
+        
+        for (auto& Char : s_Field)
+        {
+            if (Char == '"')
+            {
+                s_Result += '"';
+            }
+            
+            s_Result += Char;
+        }
+        
+        return s_Result + "\"";
+    }
+    
+    size_t GetPercentile(size_t us_Count, size_t us_Percent) noexcept
+    {
+        // Nearest rank ceil(p * N), entries are sorted slowest first
+        size_t us_Rank = ((us_Count * us_Percent) + 99) / 100;
+        
+        if (us_Rank == 0)
+        {
+            us_Rank = 1;
+        }
+        
+        return us_Count - us_Rank;
+    }
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+LoadReport::LoadReport() noexcept
+{}
+
+LoadReport::~LoadReport() noexcept
+{}
+
+//*************************************************************************************
+// Add
+//*************************************************************************************
+
+void LoadReport::Add(std::string const& s_PackagePath,
+                     Package::LoadTime const& c_LoadTime,
+                     MRH_Uint64 u64_TotalNS,
+                     bool b_Indexed,
+                     bool b_Failed) noexcept
+{
+    try
+    {
+        v_Entry.push_back({ s_PackagePath, c_LoadTime, u64_TotalNS, b_Indexed, b_Failed });
+    }
+    catch (...)
+    {}
+}
+
+//*************************************************************************************
+// Report
+//*************************************************************************************
+
+void LoadReport::Log(MRH_Uint64 u64_WallNS,
+                     size_t us_Slowest) const noexcept
+{
+    if (v_Entry.size() == 0)
+    {
+        return;
+    }
+    
+    MRH_ModuleLogger& c_Logger = MRH_ModuleLogger::Singleton();
+    
+    try
+    {
+        std::vector<Entry const*> v_Sorted = GetSorted();
+        Package::LoadTime c_Sum = { 0, 0, 0 };
+        MRH_Uint64 u64_TotalNS = 0;
+        size_t us_Indexed = 0;
+        size_t us_Failed = 0;
+        
+        for (auto& Entry : v_Entry)
+        {
+            c_Sum.u64_PathNS += Entry.c_LoadTime.u64_PathNS;
+            c_Sum.u64_TriggerNS += Entry.c_LoadTime.u64_TriggerNS;
+            c_Sum.u64_NameNS += Entry.c_LoadTime.u64_NameNS;
+            u64_TotalNS += Entry.u64_TotalNS;
+            
+            us_Indexed += (Entry.b_Indexed ? 1 : 0);
+            us_Failed += (Entry.b_Failed ? 1 : 0);
+        }
+        
+        MRH_Uint64 u64_P50 = v_Sorted[GetPercentile(v_Sorted.size(), 50)]->u64_TotalNS;
+        MRH_Uint64 u64_P99 = v_Sorted[GetPercentile(v_Sorted.size(), 99)]->u64_TotalNS;
+        
+        c_Logger.Log("LoadReport", "Loaded " +
+                                   std::to_string(v_Entry.size()) +
+                                   " packages (" +
+                                   std::to_string(us_Indexed) +
+                                   " indexed, " +
+                                   std::to_string(us_Failed) +
+                                   " failed) in " +
+                                   ToMS(u64_WallNS) +
+                                   ", total " +
+                                   ToMS(u64_TotalNS) +
+                                   " (" +
+                                   GetSteps(c_Sum) +
+                                   "), p50 " +
+                                   ToMS(u64_P50) +
+                                   ", p99 " +
+                                   ToMS(u64_P99),
+                     "LoadReport.cpp", __LINE__);
+        
+        for (size_t i = 0; i < us_Slowest && i < v_Sorted.size(); ++i)
+        {
+            Entry const& c_Entry = *(v_Sorted[i]);
+            
+            c_Logger.Log("LoadReport", "Slow package " +
+                                       c_Entry.s_PackagePath +
+                                       ": " +
+                                       ToMS(c_Entry.u64_TotalNS) +
+                                       " (" +
+                                       (c_Entry.b_Failed ? std::string("failed") : (c_Entry.b_Indexed ? std::string("indexed") : GetSteps(c_Entry.c_LoadTime))) +
+                                       ")",
+                         "LoadReport.cpp", __LINE__);
+        }
+    }
+    catch (std::exception& e)
+    {
+        c_Logger.Log("LoadReport", "Failed to create load report: " +
+                                   std::string(e.what()),
+                     "LoadReport.cpp", __LINE__);
+    }
+}
+
+bool LoadReport::Write(std::string const& s_FilePath) const noexcept
+{
+    try
+    {
+        std::ofstream f_File(s_FilePath, std::ios::trunc);
+        
+        f_File << "Package,TotalNS,PathNS,TriggerNS,NameNS,Indexed,Failed\n";
+        
+        for (auto& Entry : GetSorted())
+        {
+            f_File << GetCSVField(Entry->s_PackagePath) << ','
+                   << Entry->u64_TotalNS << ','
+                   << Entry->c_LoadTime.u64_PathNS << ','
+                   << Entry->c_LoadTime.u64_TriggerNS << ','
+                   << Entry->c_LoadTime.u64_NameNS << ','
+                   << (Entry->b_Indexed ? 1 : 0) << ','
+                   << (Entry->b_Failed ? 1 : 0) << '\n';
+        }
+        
+        f_File.close();
+        
+        return f_File.fail() == false;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+std::vector<LoadReport::Entry const*> LoadReport::GetSorted() const
+{
+    std::vector<Entry const*> v_Sorted;
+    v_Sorted.reserve(v_Entry.size());
+    
+    for (auto& Entry : v_Entry)
+    {
+        v_Sorted.emplace_back(&Entry);
+    }
+    
+    std::stable_sort(v_Sorted.begin(), v_Sorted.end(), [](Entry const* p_A, Entry const* p_B)
+    {
+        return p_A->u64_TotalNS > p_B->u64_TotalNS;
+    });
+    
+    return v_Sorted;
+}
@@ -0,0 +1,139 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LoadReport_h
+#define LoadReport_h
+
+// C / C++
+#include <string>
+#include <vector>
+
+// External
+
+// Project
+#include "./Package.h"
+
+
+class LoadReport
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    LoadReport() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~LoadReport() noexcept;
+    
+    //*************************************************************************************
+    // Add
+    //*************************************************************************************
+    
+    /**
+     *  Add a package load to the report.
+     *
+     *  \param s_PackagePath The full path to the package.
+     *  \param c_LoadTime The time spent in each load step. Steps are 
+     *                    not reported for failed packages.
+     *  \param u64_TotalNS The total time spent loading the package.
+     *  \param b_Indexed If the package was taken from the package index.
+     *  \param b_Failed If the package failed to load.
+     */
+    
+    void Add(std::string const& s_PackagePath,
+             Package::LoadTime const& c_LoadTime,
+             MRH_Uint64 u64_TotalNS,
+             bool b_Indexed,
+             bool b_Failed) noexcept;
+    
+    //*************************************************************************************
+    // Report
+    //*************************************************************************************
+    
+    /**
+     *  Log a summary of all package loads with the slowest packages.
+     *
+     *  \param u64_WallNS The wall clock time spent loading all packages.
+     *  \param us_Slowest The amount of slowest packages to list.
+     */
+    
+    void Log(MRH_Uint64 u64_WallNS,
+             size_t us_Slowest) const noexcept;
+    
+    /**
+     *  Write all package loads to a file, slowest first. The file 
+     *  is replaced.
+     *
+     *  \param s_FilePath The full path to the report file.
+     *
+     *  \return true if the report was written, false if not.
+     */
+    
+    bool Write(std::string const& s_FilePath) const noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Entry
+    {
+    public:
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        std::string s_PackagePath;
+        Package::LoadTime c_LoadTime;
+        MRH_Uint64 u64_TotalNS;
+        bool b_Indexed;
+        bool b_Failed;
+    };
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get all entries sorted by total load time, slowest first.
+     *
+     *  \return The sorted entries.
+     */
+    
+    std::vector<Entry const*> GetSorted() const;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::vector<Entry> v_Entry;
+    
+protected:
+    
+};
+
+#endif /* LoadReport_h */
@@ -0,0 +1,181 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+// C / C++
+#include <algorithm>
+
+// External
+
+// Project
+#include "./NameIndex.h"
+#include "../Compare/Levenshtein.h"
+
+namespace
+{
+    constexpr size_t us_Q = 3;
+    
+    // Highest edit distance between the name and any part of the input 
+    // which still reaches the similarity. Longer parts allow more edits, 
+    // but need at least one edit per additional character
+    size_t GetMaxDistance(size_t us_NameLength, size_t us_InputLength, float f32_Similarity) noexcept
+    {
+        size_t us_Max = Levenshtein::MaxDistance(us_NameLength, f32_Similarity);
+        
+        for (size_t i = us_NameLength + 1; i <= us_InputLength; ++i)
+        {
+            size_t us_Distance = Levenshtein::MaxDistance(i, f32_Similarity);
+            
+            // The distance grows by at most 1 per character, longer 
+            // parts can't reach the similarity either
+            if (i - us_NameLength > us_Distance)
+            {
+                break;
+            }
+            
+            us_Max = us_Distance;
+        }
+        
+        return us_Max;
+    }
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+NameIndex::NameIndex() noexcept
+{}
+
+NameIndex::NameIndex(TriggerTable const& c_Table,
+                     std::vector<std::unique_ptr<Package>> const& v_Package) : v_GramStart(v_Package.size() + 1, 0),
+                                                                               v_Length(v_Package.size(), 0)
+{
+    std::vector<std::string_view> v_Name(v_Package.size());
+    std::vector<MRH_Uint32> v_NameGram;
+    
+    for (size_t i = 0; i < c_Table.GetPackageCount(); ++i)
+    {
+        Package::ID u32_PackageID = c_Table.GetPackageID(i);
+        
+        v_Name[u32_PackageID] = v_Package[u32_PackageID]->GetApplicationName();
+        v_Length[u32_PackageID] = static_cast<MRH_Uint32>(v_Name[u32_PackageID].size());
+    }
+    
+    for (size_t i = 0; i < v_Name.size(); ++i)
+    {
+        GetGrams(v_Name[i], v_NameGram);
+        
+        v_Gram.insert(v_Gram.end(), v_NameGram.begin(), v_NameGram.end());
+        v_GramStart[i + 1] = static_cast<MRH_Uint32>(v_Gram.size());
+    }
+}
+
+NameIndex::~NameIndex() noexcept
+{}
+
+//*************************************************************************************
+// Grams
+//*************************************************************************************
+
+void NameIndex::GetGrams(std::string_view s_String,
+                         std::vector<MRH_Uint32>& v_Gram)
+{
+    v_Gram.clear();
+    
+    if (s_String.size() < us_Q)
+    {
+        return;
+    }
+    
+    for (size_t i = 0; i + us_Q <= s_String.size(); ++i)
+    {
+        MRH_Uint32 u32_Gram = 0;
+        
+        for (size_t j = 0; j < us_Q; ++j)
+        {
+            MRH_Uint8 u8_Char = static_cast<MRH_Uint8>(s_String[i + j]);
+            
+            if (u8_Char >= 'A' && u8_Char <= 'Z')
+            {
+                u8_Char += 'a' - 'A';
+            }
+            
+            u32_Gram = (u32_Gram << 8) | u8_Char;
+        }
+        
+        v_Gram.emplace_back(u32_Gram);
+    }
+    
+    std::sort(v_Gram.begin(), v_Gram.end());
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+bool NameIndex::GetCandidate(Package::ID u32_PackageID,
+                             std::string_view s_Input,
+                             float f32_Similarity) const
+{
+    if (u32_PackageID >= v_Length.size())
+    {
+        return true;
+    }
+    
+    // Each edit removes at most q name grams from the part of the input 
+    // matching the name (q-gram lemma), the rest is found in the input
+    long long s64_Gram = static_cast<long long>(v_GramStart[u32_PackageID + 1] - v_GramStart[u32_PackageID]);
+    long long s64_MinCommon = s64_Gram - static_cast<long long>(GetMaxDistance(v_Length[u32_PackageID], s_Input.size(), f32_Similarity) * us_Q);
+    
+    if (s64_MinCommon <= 0)
+    {
+        return true;
+    }
+    
+    // Disambiguation checks many names against the same input
+    if (s_Input.compare(s_LastInput) != 0)
+    {
+        std::vector<MRH_Uint32> v_Current;
+        
+        GetGrams(s_Input, v_Current);
+        v_Current.erase(std::unique(v_Current.begin(), v_Current.end()), v_Current.end());
+        
+        // Only replace both once nothing can throw anymore
+        s_LastInput = s_Input;
+        v_LastGram.swap(v_Current);
+    }
+    
+    auto Input = v_LastGram.begin();
+    long long s64_Common = 0;
+    
+    for (MRH_Uint32 i = v_GramStart[u32_PackageID]; i < v_GramStart[u32_PackageID + 1]; ++i)
+    {
+        Input = std::lower_bound(Input, v_LastGram.end(), v_Gram[i]);
+        
+        if (Input == v_LastGram.end())
+        {
+            break;
+        }
+        else if (*Input == v_Gram[i] && ++s64_Common >= s64_MinCommon)
+        {
+            return true;
+        }
+    }
+    
+    return false;
+}
@@ -0,0 +1,119 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#ifndef NameIndex_h
+#define NameIndex_h
+
+// C / C++
+#include <vector>
+#include <memory>
+#include <string_view>
+
+// External
+
+// Project
+#include "./TriggerTable.h"
+
+
+class NameIndex
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor. The index is empty.
+     */
+    
+    NameIndex() noexcept;
+    
+    /**
+     *  Table constructor.
+     *
+     *  \param c_Table The trigger table with the packages to index.
+     *  \param v_Package The packages, indexed by package id.
+     */
+    
+    NameIndex(TriggerTable const& c_Table,
+              std::vector<std::unique_ptr<Package>> const& v_Package);
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~NameIndex() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Check if the application name of a package might be contained in a 
+     *  input. Packages which are rejected are guaranteed to have no part of 
+     *  the input reaching the similarity with their name. This function is 
+     *  not thread safe.
+     *
+     *  \param u32_PackageID The id of the package to check.
+     *  \param s_Input The input to check against.
+     *  \param f32_Similarity The required similarity.
+     *
+     *  \return true if the name might be contained, false if not.
+     */
+    
+    bool GetCandidate(Package::ID u32_PackageID,
+                      std::string_view s_Input,
+                      float f32_Similarity) const;
+    
+private:
+    
+    //*************************************************************************************
+    // Grams
+    //*************************************************************************************
+    
+    /**
+     *  Get the sorted trigrams of a string. ASCII letters are compared 
+     *  case insensitive. Equal grams are listed multiple times.
+     *
+     *  \param s_String The string to split.
+     *  \param v_Gram The grams of the string.
+     */
+    
+    static void GetGrams(std::string_view s_String,
+                         std::vector<MRH_Uint32>& v_Gram);
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    // Per package id, ids without a name have no grams
+    std::vector<MRH_Uint32> v_GramStart;
+    std::vector<MRH_Uint32> v_Length;
+    
+    // Name grams, sorted per package
+    std::vector<MRH_Uint32> v_Gram;
+    
+    // Unique grams of the last input
+    mutable std::string s_LastInput;
+    mutable std::vector<MRH_Uint32> v_LastGram;
+    
+protected:
+    
+};
+
+#endif /* NameIndex_h */
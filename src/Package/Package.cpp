@@ -16,13 +16,19 @@
 
 // C / C++
 #include <fstream>
+#include <chrono>
+#include <sys/stat.h>
 
 // External
-#include <libmrhvt/String/MRH_LocalisedPath.h>
+#include <libmrhvt/Input/MRH_InputTrigger.h>
+#include <libmrhvt/Error/MRH_VTException.h>
 #include <libmrhab/Module/Tools/MRH_ModuleLogger.h>
 
 // Project
 #include "./Package.h"
+#include "./TriggerTable.h"
+#include "../Compare/Normalise.h"
+#include "../Tools/LocalisedPathCache.h"
 
 // Pre-defined
 #define PACKAGE_LAUNCH_TRIGGER_DIRECTORY "LaunchTrigger"
@@ -31,49 +37,304 @@
 #define PACKAGE_APPLICATION_NAME_FILE "ApplicationName.txt"
 #define DEVOTION_LAUNCH_RECOMMENDATION_DIRECTORY "FSRoot/Devotion"
 #define DEVOTION_LAUNCH_RECOMMENDATION_FILE "LaunchRecommendation.mrhog"
+#ifndef LAUNCH_TRIGGER_VERIFY
+    #define LAUNCH_TRIGGER_VERIFY 0 // Compare parsed launch triggers with MRH_InputTrigger
+#endif
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+    
+    MRH_Uint64 GetNS(Clock::time_point c_Start, Clock::time_point c_End) noexcept
+    {
+        return static_cast<MRH_Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(c_End - c_Start).count());
+    }
+    
+#if LAUNCH_TRIGGER_VERIFY > 0
+    void VerifyLaunchTrigger(std::string const& s_FilePath) noexcept
+    {
+        MRH_ModuleLogger& c_Logger = MRH_ModuleLogger::Singleton();
+        std::unique_ptr<MRH_InputTrigger> p_Library;
+        std::unique_ptr<LaunchTrigger> p_Local;
+        
+        try
+        {
+            p_Library = std::make_unique<MRH_InputTrigger>(s_FilePath);
+        }
+        catch (...)
+        {}
+        
+        try
+        {
+            p_Local = std::make_unique<LaunchTrigger>(s_FilePath);
+        }
+        catch (...)
+        {}
+        
+        if ((p_Library == nullptr) != (p_Local == nullptr))
+        {
+            c_Logger.Log("Package", s_FilePath +
+                                    ": Launch trigger only rejected by " +
+                                    (p_Local == nullptr ? "LaunchTrigger" : "MRH_InputTrigger"),
+                         "Package.cpp", __LINE__);
+            return;
+        }
+        else if (p_Local == nullptr)
+        {
+            return;
+        }
+        
+        try
+        {
+            // Every trigger string used as input has to select the same 
+            // trigger, the table is evaluated like the launcher does
+            StringPool c_StringPool;
+            TriggerTable c_Table;
+            
+            c_Table.Add(0, *p_Local, c_StringPool);
+            
+            for (auto& Trigger : p_Local->GetTriggers())
+            {
+                // The launcher passed 1 before the trigger table was used
+                MRH_InputTrigger::Evaluation c_Expected = p_Library->Evaluate(Trigger.s_String, 1);
+                TriggerTable::Evaluation c_Result = c_Table.Evaluate(0, Normalise::String(Trigger.s_String), 0);
+                
+                if (c_Expected.first != c_Result.s32_Value ||
+                    (c_Expected.first >= 0 && c_Expected.second != c_Result.u32_Weight))
+                {
+                    c_Logger.Log("Package", s_FilePath +
+                                            ": Launch trigger " +
+                                            Trigger.s_String +
+                                            " differs from MRH_InputTrigger (value " +
+                                            std::to_string(c_Result.s32_Value) +
+                                            " / " +
+                                            std::to_string(c_Expected.first) +
+                                            ", weight " +
+                                            std::to_string(c_Result.u32_Weight) +
+                                            " / " +
+                                            std::to_string(c_Expected.second) +
+                                            ")",
+                                 "Package.cpp", __LINE__);
+                }
+            }
+        }
+        catch (std::exception& e)
+        {
+            c_Logger.Log("Package", s_FilePath +
+                                    ": Failed to verify launch trigger: " +
+                                    e.what(),
+                         "Package.cpp", __LINE__);
+        }
+    }
+#endif
+}
 
 
 //*************************************************************************************
 // Constructor / Destructor
 //*************************************************************************************
 
-Package::Package(std::string const& s_PackagePath) : s_PackagePath(s_PackagePath),
-                                                     c_LaunchTrigger(MRH_LocalisedPath::GetPath(s_PackagePath + "/" + PACKAGE_LAUNCH_TRIGGER_DIRECTORY,
-                                                                                                PACKAGE_LAUNCH_TRIGGER_FILE)),
-                                                     s_ApplicationName("")
+Package::Package(std::string_view s_PackagePath,
+                 StringPool& c_StringPool,
+                 bool b_Lazy) : c_StringPool(c_StringPool),
+                                s_PackagePath(c_StringPool.Add(s_PackagePath)),
+                                s_ApplicationName(""),
+                                c_LoadTime({ 0, 0, 0 })
+{
+    if (b_Lazy == false)
+    {
+        // Failures throw and are handed to the caller
+        std::call_once(c_LoadFlag, &Package::Load, this);
+    }
+}
+
+Package::Package(std::string_view s_PackagePath,
+                 StringPool& c_StringPool,
+                 std::string_view s_ApplicationName,
+                 LaunchTrigger const& c_LaunchTrigger,
+                 std::vector<SourceFile> const& v_SourceFile) : c_StringPool(c_StringPool),
+                                                                s_PackagePath(c_StringPool.Add(s_PackagePath)),
+                                                                s_ApplicationName(c_StringPool.Add(s_ApplicationName)),
+                                                                c_LaunchTrigger(c_LaunchTrigger),
+                                                                v_SourceFile(v_SourceFile),
+                                                                c_LoadTime({ 0, 0, 0 })
+{
+    // Already loaded
+    std::call_once(c_LoadFlag, []() {});
+}
+
+Package::Package(Package const& c_Package,
+                 StringPool& c_StringPool) : c_StringPool(c_StringPool),
+                                             s_PackagePath(c_StringPool.Add(c_Package.GetPackagePath())),
+                                             s_ApplicationName(c_StringPool.Add(c_Package.GetApplicationName())),
+                                             c_LaunchTrigger(c_Package.GetLaunchTrigger()),
+                                             c_LoadTime(c_Package.GetLoadTime())
+{
+    for (auto& Source : c_Package.GetSourceFiles())
+    {
+        v_SourceFile.emplace_back(c_StringPool.Add(Source.s_Path), Source.u64_ModifiedNS, Source.u64_Size);
+    }
+    
+    // Loaded by the getters above
+    std::call_once(c_LoadFlag, []() {});
+}
+
+Package::~Package() noexcept
+{}
+
+Package::SourceFile::SourceFile(std::string_view s_Path) noexcept : s_Path(s_Path),
+                                                                    u64_ModifiedNS(0),
+                                                                    u64_Size(0)
+{
+    struct stat c_Stat;
+    
+    // Pooled strings are null terminated
+    if (stat(s_Path.data(), &c_Stat) == 0)
+    {
+        u64_ModifiedNS = (static_cast<MRH_Uint64>(c_Stat.st_mtim.tv_sec) * 1000000000ULL) + static_cast<MRH_Uint64>(c_Stat.st_mtim.tv_nsec);
+        u64_Size = static_cast<MRH_Uint64>(c_Stat.st_size);
+    }
+}
+
+Package::SourceFile::SourceFile(std::string_view s_Path,
+                                MRH_Uint64 u64_ModifiedNS,
+                                MRH_Uint64 u64_Size) noexcept : s_Path(s_Path),
+                                                                u64_ModifiedNS(u64_ModifiedNS),
+                                                                u64_Size(u64_Size)
+{}
+
+//*************************************************************************************
+// Launch Trigger
+//*************************************************************************************
+
+void Package::ReleaseLaunchTrigger() noexcept
 {
+    LoadLazy();
+    c_LaunchTrigger = LaunchTrigger();
+}
+
+//*************************************************************************************
+// Load
+//*************************************************************************************
+
+void Package::Load() const
+{
+    // @NOTE: File states are recorded before reading, a change while
+    //        reading will then be noticed by the package index
+    Clock::time_point c_Start = Clock::now();
+    
+    std::string s_File = LoadLocalisedPath(std::string(s_PackagePath) + "/" + PACKAGE_LAUNCH_TRIGGER_DIRECTORY,
+                                           PACKAGE_LAUNCH_TRIGGER_FILE);
+    
+#if LAUNCH_TRIGGER_VERIFY > 0
+    VerifyLaunchTrigger(s_File);
+#endif
+    
+    Clock::time_point c_TriggerStart = Clock::now();
+    c_LaunchTrigger = LaunchTrigger(s_File);
+    Clock::time_point c_TriggerEnd = Clock::now();
+    
     // Load the application name
+    s_File = LoadLocalisedPath(std::string(s_PackagePath) + "/" + PACKAGE_APPLICATION_NAME_DIRECTORY,
+                               PACKAGE_APPLICATION_NAME_FILE);
+    
+    Clock::time_point c_NameStart = Clock::now();
     std::ifstream f_File;
+    std::string s_Name;
     
-    f_File.open(MRH_LocalisedPath::GetPath(s_PackagePath + "/" + PACKAGE_APPLICATION_NAME_DIRECTORY,
-                                           PACKAGE_APPLICATION_NAME_FILE));
-    std::getline(f_File, s_ApplicationName);
+    f_File.open(s_File);
+    std::getline(f_File, s_Name);
     f_File.close();
     
-    if (s_ApplicationName.size() == 0)
+    if (s_Name.size() == 0)
     {
         throw MRH_VTException("Invalid application name!");
     }
+    
+    s_ApplicationName = c_StringPool.Add(s_Name);
+    
+    c_LoadTime.u64_PathNS = GetNS(c_Start, c_TriggerStart) + GetNS(c_TriggerEnd, c_NameStart);
+    c_LoadTime.u64_TriggerNS = GetNS(c_TriggerStart, c_TriggerEnd);
+    c_LoadTime.u64_NameNS = GetNS(c_NameStart, Clock::now());
 }
 
-Package::~Package() noexcept
-{}
+std::string Package::LoadLocalisedPath(std::string const& s_Directory,
+                                       const char* p_File) const
+{
+    v_SourceFile.emplace_back(c_StringPool.Add(s_Directory));
+    
+    std::string s_File = GetLocalisedPath(s_Directory, p_File);
+    v_SourceFile.emplace_back(c_StringPool.Add(s_File));
+    
+    return s_File;
+}
+
+void Package::LoadLazy() const noexcept
+{
+    std::call_once(c_LoadFlag, [this]()
+    {
+        try
+        {
+            Load();
+        }
+        catch (std::exception& e)
+        {
+            MRH_ModuleLogger::Singleton().Log("Package", "Failed to load package " +
+                                                         std::string(s_PackagePath) +
+                                                         ": " +
+                                                         e.what(),
+                                              "Package.cpp", __LINE__);
+            
+            // Never match a broken package
+            s_ApplicationName = "";
+            c_LaunchTrigger = LaunchTrigger();
+            v_SourceFile.clear();
+        }
+    });
+}
 
 //*************************************************************************************
 // Getters
 //*************************************************************************************
 
-std::string const& Package::GetPackagePath() const noexcept
+bool Package::SourceFile::GetChanged() const noexcept
+{
+    SourceFile c_Current(s_Path);
+    
+    return c_Current.u64_ModifiedNS != u64_ModifiedNS || c_Current.u64_Size != u64_Size;
+}
+
+std::string_view Package::GetPackagePath() const noexcept
 {
     return s_PackagePath;
 }
 
-std::string const& Package::GetApplicationName() const noexcept
+std::string_view Package::GetApplicationName() const noexcept
 {
+    LoadLazy();
     return s_ApplicationName;
 }
 
-MRH_InputTrigger const& Package::GetLaunchTrigger() const noexcept
+LaunchTrigger const& Package::GetLaunchTrigger() const noexcept
 {
+    LoadLazy();
     return c_LaunchTrigger;
 }
+
+std::vector<Package::SourceFile> const& Package::GetSourceFiles() const noexcept
+{
+    LoadLazy();
+    return v_SourceFile;
+}
+
+Package::LoadTime const& Package::GetLoadTime() const noexcept
+{
+    return c_LoadTime;
+}
+
+std::string Package::GetLocalisedPath(std::string const& s_Directory,
+                                      std::string const& s_File)
+{
+    return LocalisedPathCache::Singleton().GetPath(s_Directory,
+                                                   s_File);
+}
@@ -19,18 +19,90 @@
 
 // C / C++
 #include <memory>
+#include <vector>
+#include <mutex>
+#include <string_view>
 
 // External
-#include <libmrhvt/Input/MRH_InputTrigger.h>
-#include <libmrhvt/Output/MRH_OutputGenerator.h>
 
 // Project
+#include "./LaunchTrigger.h"
+#include "../Tools/StringPool.h"
 
 
 class Package
 {
 public:
     
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    // Stable package id inside a package list
+    typedef MRH_Uint32 ID;
+    
+    struct SourceFile
+    {
+    public:
+        
+        //*************************************************************************************
+        // Constructor
+        //*************************************************************************************
+        
+        /**
+         *  Default constructor. The file state is read on construction.
+         *
+         *  \param s_Path The pooled full path to the source file.
+         */
+        
+        SourceFile(std::string_view s_Path) noexcept;
+        
+        /**
+         *  Data constructor.
+         *
+         *  \param s_Path The pooled full path to the source file.
+         *  \param u64_ModifiedNS The last modification time in nanoseconds.
+         *  \param u64_Size The file size in bytes.
+         */
+        
+        SourceFile(std::string_view s_Path,
+                   MRH_Uint64 u64_ModifiedNS,
+                   MRH_Uint64 u64_Size) noexcept;
+        
+        //*************************************************************************************
+        // Getters
+        //*************************************************************************************
+        
+        /**
+         *  Check if the file changed since the file state was recorded.
+         *
+         *  \return true if the file changed, false if not.
+         */
+        
+        bool GetChanged() const noexcept;
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        std::string_view s_Path;
+        MRH_Uint64 u64_ModifiedNS;
+        MRH_Uint64 u64_Size;
+    };
+    
+    struct LoadTime
+    {
+    public:
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        MRH_Uint64 u64_PathNS; // Localised path resolution and file states
+        MRH_Uint64 u64_TriggerNS; // Launch trigger parse
+        MRH_Uint64 u64_NameNS; // Application name read
+    };
+    
     //*************************************************************************************
     // Constructor / Destructor
     //*************************************************************************************
@@ -39,9 +111,44 @@ public:
      *  Default constructor.
      *
      *  \param s_PackagePath The full path to the package.
+     *  \param c_StringPool The pool owning the package strings. The pool has 
+     *                      to outlive the package.
+     *  \param b_Lazy If the package data should be loaded on first access.
      */
     
-    Package(std::string const& s_PackagePath);
+    Package(std::string_view s_PackagePath,
+            StringPool& c_StringPool,
+            bool b_Lazy);
+    
+    /**
+     *  Data constructor.
+     *
+     *  \param s_PackagePath The full path to the package.
+     *  \param c_StringPool The pool owning the package strings. The pool has 
+     *                      to outlive the package.
+     *  \param s_ApplicationName The application name.
+     *  \param c_LaunchTrigger The application launch trigger.
+     *  \param v_SourceFile The files the package data was read from, with 
+     *                      pooled paths.
+     */
+    
+    Package(std::string_view s_PackagePath,
+            StringPool& c_StringPool,
+            std::string_view s_ApplicationName,
+            LaunchTrigger const& c_LaunchTrigger,
+            std::vector<SourceFile> const& v_SourceFile);
+    
+    /**
+     *  Pool constructor. The package is copied with all strings stored in 
+     *  another pool, lazy packages are loaded first.
+     *
+     *  \param c_Package The package to copy.
+     *  \param c_StringPool The pool owning the package strings. The pool has 
+     *                      to outlive the package.
+     */
+    
+    Package(Package const& c_Package,
+            StringPool& c_StringPool);
     
     /**
      *  Default destructor.
@@ -49,6 +156,17 @@ public:
     
     ~Package() noexcept;
     
+    //*************************************************************************************
+    // Launch Trigger
+    //*************************************************************************************
+    
+    /**
+     *  Release the launch trigger data. Used once the launch trigger was 
+     *  copied to a trigger table.
+     */
+    
+    void ReleaseLaunchTrigger() noexcept;
+    
     //*************************************************************************************
     // Getters
     //*************************************************************************************
@@ -59,33 +177,102 @@ public:
      *  \return The full package path.
      */
     
-    std::string const& GetPackagePath() const noexcept;
+    std::string_view GetPackagePath() const noexcept;
     
     /**
-     *  Get the application name.
+     *  Get the application name. Lazy packages are loaded on first access, 
+     *  a lazy package which failed to load has no name.
      *
      *  \return The application name.
      */
     
-    std::string const& GetApplicationName() const noexcept;
+    std::string_view GetApplicationName() const noexcept;
     
     /**
-     *  Get the application launch trigger.
+     *  Get the application launch trigger. Lazy packages are loaded on first 
+     *  access, a lazy package which failed to load has no triggers. A released 
+     *  launch trigger has no triggers.
      *
      *  \return The application launch trigger.
      */
     
-    MRH_InputTrigger const& GetLaunchTrigger() const noexcept;
+    LaunchTrigger const& GetLaunchTrigger() const noexcept;
+    
+    /**
+     *  Get the files the package data was read from.
+     *
+     *  \return The package source files.
+     */
+    
+    std::vector<SourceFile> const& GetSourceFiles() const noexcept;
+    
+    /**
+     *  Get the time spent loading the package data. The time is 
+     *  zero for packages which were not loaded from their files.
+     *
+     *  \return The package load time.
+     */
+    
+    LoadTime const& GetLoadTime() const noexcept;
+    
+    /**
+     *  Resolve a localised package file for the current locale.
+     *
+     *  \param s_Directory The full path to the directory containing the 
+     *                     locale subdirectories.
+     *  \param s_File The file name.
+     *
+     *  \return The full path to the localised file.
+     */
+    
+    static std::string GetLocalisedPath(std::string const& s_Directory,
+                                        std::string const& s_File);
     
 private:
     
+    //*************************************************************************************
+    // Load
+    //*************************************************************************************
+    
+    /**
+     *  Load the package data.
+     */
+    
+    void Load() const;
+    
+    /**
+     *  Load the package data if not yet loaded. Load failures are logged.
+     */
+    
+    void LoadLazy() const noexcept;
+    
+    /**
+     *  Resolve a localised package file and record the directory 
+     *  and file states.
+     *
+     *  \param s_Directory The full path to the directory containing the 
+     *                     locale subdirectories.
+     *  \param p_File The file name.
+     *
+     *  \return The full path to the localised file.
+     */
+    
+    std::string LoadLocalisedPath(std::string const& s_Directory,
+                                  const char* p_File) const;
+    
     //*************************************************************************************
     // Data
     //*************************************************************************************
     
-    std::string s_PackagePath;
-    std::string s_ApplicationName;
-    MRH_InputTrigger c_LaunchTrigger;
+    StringPool& c_StringPool;
+    std::string_view s_PackagePath;
+    
+    // Loaded on first access for lazy packages
+    mutable std::once_flag c_LoadFlag;
+    mutable std::string_view s_ApplicationName;
+    mutable LaunchTrigger c_LaunchTrigger;
+    mutable std::vector<SourceFile> v_SourceFile;
+    mutable LoadTime c_LoadTime;
     
 protected:
     
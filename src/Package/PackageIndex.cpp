@@ -0,0 +1,419 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <fstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// External
+#include <libmrhab/Module/Tools/MRH_ModuleLogger.h>
+
+// Project
+#include "./PackageIndex.h"
+
+// Pre-defined
+namespace
+{
+    const char p_Magic[8] = { 'M', 'R', 'H', 'P', 'K', 'I', 'D', 'X' };
+    constexpr MRH_Uint32 u32_Version = 1;
+    
+    class Reader
+    {
+    public:
+        
+        Reader(const MRH_Uint8* p_Data,
+               size_t us_Size,
+               size_t us_Position) noexcept : p_Data(p_Data),
+                                              us_Size(us_Size),
+                                              us_Position(us_Position)
+        {}
+        
+        template<typename T>
+        bool Read(T& Value) noexcept
+        {
+            if (us_Position > us_Size || us_Size - us_Position < sizeof(T))
+            {
+                return false;
+            }
+            
+            // Records are not aligned
+            std::memcpy(&Value, p_Data + us_Position, sizeof(T));
+            us_Position += sizeof(T);
+            
+            return true;
+        }
+        
+        bool Read(std::string_view& s_Value) noexcept
+        {
+            MRH_Uint32 u32_Length;
+            
+            if (Read(u32_Length) == false || us_Size - us_Position < u32_Length)
+            {
+                return false;
+            }
+            
+            // Views into the mapped file
+            s_Value = std::string_view(reinterpret_cast<const char*>(p_Data + us_Position), u32_Length);
+            us_Position += u32_Length;
+            
+            return true;
+        }
+        
+        const MRH_Uint8* p_Data;
+        size_t us_Size;
+        size_t us_Position;
+    };
+    
+    template<typename T>
+    void Append(std::string& s_Buffer, T Value) noexcept
+    {
+        s_Buffer.append(reinterpret_cast<const char*>(&Value), sizeof(T));
+    }
+    
+    void Append(std::string& s_Buffer, std::string_view s_Value) noexcept
+    {
+        Append(s_Buffer, static_cast<MRH_Uint32>(s_Value.size()));
+        s_Buffer.append(s_Value);
+    }
+    
+    void Append(std::string& s_Buffer, std::string const& s_Value) noexcept
+    {
+        Append(s_Buffer, std::string_view(s_Value));
+    }
+    
+    bool CreateDirectories(std::string const& s_FilePath) noexcept
+    {
+        // Create every missing parent directory of the file
+        for (size_t us_End = s_FilePath.find('/', 1); us_End != std::string::npos; us_End = s_FilePath.find('/', us_End + 1))
+        {
+            if (mkdir(s_FilePath.substr(0, us_End).c_str(), 0755) < 0 && errno != EEXIST)
+            {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+PackageIndex::PackageIndex(std::string const& s_FilePath) noexcept : p_Data(NULL),
+                                                                     us_Size(0)
+{
+    int i_FD = open(s_FilePath.c_str(), O_RDONLY | O_CLOEXEC);
+    
+    if (i_FD < 0)
+    {
+        return;
+    }
+    
+    struct stat c_Stat;
+    
+    if (fstat(i_FD, &c_Stat) < 0 || c_Stat.st_size < static_cast<off_t>(sizeof(p_Magic) + (sizeof(MRH_Uint32) * 2)))
+    {
+        close(i_FD);
+        return;
+    }
+    
+    p_Data = mmap(NULL, c_Stat.st_size, PROT_READ, MAP_PRIVATE, i_FD, 0);
+    close(i_FD);
+    
+    if (p_Data == MAP_FAILED)
+    {
+        p_Data = NULL;
+        return;
+    }
+    
+    us_Size = static_cast<size_t>(c_Stat.st_size);
+    
+    // Check header
+    Reader c_Reader(static_cast<const MRH_Uint8*>(p_Data), us_Size, sizeof(p_Magic));
+    MRH_Uint32 u32_FileVersion;
+    MRH_Uint32 u32_Count;
+    
+    if (std::memcmp(p_Data, p_Magic, sizeof(p_Magic)) != 0 ||
+        c_Reader.Read(u32_FileVersion) == false || u32_FileVersion != u32_Version ||
+        c_Reader.Read(u32_Count) == false)
+    {
+        return;
+    }
+    
+    // Build record lookup, records are only read on request
+    try
+    {
+        std::string_view s_PackagePath;
+        MRH_Uint32 u32_RecordSize;
+        
+        for (MRH_Uint32 i = 0; i < u32_Count; ++i)
+        {
+            if (c_Reader.Read(u32_RecordSize) == false || us_Size - c_Reader.us_Position < u32_RecordSize)
+            {
+                m_Record.clear();
+                return;
+            }
+            
+            size_t us_Record = c_Reader.us_Position;
+            
+            if (c_Reader.Read(s_PackagePath) == false)
+            {
+                m_Record.clear();
+                return;
+            }
+            
+            m_Record[s_PackagePath] = us_Record;
+            c_Reader.us_Position = us_Record + u32_RecordSize;
+        }
+    }
+    catch (...)
+    {
+        m_Record.clear();
+    }
+}
+
+PackageIndex::~PackageIndex() noexcept
+{
+    if (p_Data != NULL)
+    {
+        munmap(p_Data, us_Size);
+    }
+}
+
+//*************************************************************************************
+// Write
+//*************************************************************************************
+
+bool PackageIndex::Write(std::string const& s_FilePath,
+                         std::vector<std::unique_ptr<Package>> const& v_Package,
+                         TriggerTable const& c_TriggerTable) noexcept
+{
+    try
+    {
+        std::string s_Buffer(p_Magic, sizeof(p_Magic));
+        std::string s_Record;
+        
+        std::vector<bool> v_Written(v_Package.size(), false);
+        MRH_Uint32 u32_Count = 0;
+        
+        Append(s_Buffer, u32_Version);
+        Append(s_Buffer, u32_Count); // Set later
+        
+        for (size_t i = 0; i < c_TriggerTable.GetPackageCount(); ++i)
+        {
+            Package::ID u32_PackageID = c_TriggerTable.GetPackageID(i);
+            Package const& c_Package = *(v_Package[u32_PackageID]);
+            
+            // Failed lazy packages have no source files and are 
+            // loaded again next time
+            if (v_Written[u32_PackageID] == true || c_Package.GetSourceFiles().size() == 0)
+            {
+                continue;
+            }
+            
+            LaunchTrigger c_Trigger = c_TriggerTable.GetLaunchTrigger(i);
+            
+            v_Written[u32_PackageID] = true;
+            ++u32_Count;
+            
+            s_Record.clear();
+            
+            Append(s_Record, c_Package.GetPackagePath());
+            Append(s_Record, c_Package.GetApplicationName());
+            
+            Append(s_Record, static_cast<MRH_Uint32>(c_Package.GetSourceFiles().size()));
+            
+            for (auto& Source : c_Package.GetSourceFiles())
+            {
+                Append(s_Record, Source.s_Path);
+                Append(s_Record, Source.u64_ModifiedNS);
+                Append(s_Record, Source.u64_Size);
+            }
+            
+            Append(s_Record, static_cast<MRH_Uint32>(c_Trigger.GetCompareMethod()));
+            Append(s_Record, c_Trigger.GetSimilarity());
+            Append(s_Record, static_cast<MRH_Uint32>(c_Trigger.GetTriggers().size()));
+            
+            for (auto& Trigger : c_Trigger.GetTriggers())
+            {
+                Append(s_Record, Trigger.s_String);
+                Append(s_Record, Trigger.u32_Weight);
+                Append(s_Record, Trigger.s32_Value);
+            }
+            
+            Append(s_Buffer, static_cast<MRH_Uint32>(s_Record.size()));
+            s_Buffer += s_Record;
+        }
+        
+        std::memcpy(&(s_Buffer[sizeof(p_Magic) + sizeof(u32_Version)]), &u32_Count, sizeof(u32_Count));
+        
+        // Write to a temporary file first, a reader never sees
+        // a partial index
+        std::string s_TempPath = s_FilePath + ".tmp";
+        
+        if (CreateDirectories(s_FilePath) == false)
+        {
+            MRH_ModuleLogger::Singleton().Log("PackageIndex", "Failed to create package index directory for " +
+                                                              s_FilePath,
+                                              "PackageIndex.cpp", __LINE__);
+            return false;
+        }
+        
+        std::ofstream f_File(s_TempPath, std::ios::binary | std::ios::trunc);
+        
+        f_File.write(s_Buffer.data(), s_Buffer.size());
+        f_File.close();
+        
+        if (f_File.fail() == true || std::rename(s_TempPath.c_str(), s_FilePath.c_str()) != 0)
+        {
+            std::remove(s_TempPath.c_str());
+            
+            MRH_ModuleLogger::Singleton().Log("PackageIndex", "Failed to write package index " +
+                                                              s_FilePath,
+                                              "PackageIndex.cpp", __LINE__);
+            return false;
+        }
+        
+        return true;
+    }
+    catch (std::exception& e)
+    {
+        MRH_ModuleLogger::Singleton().Log("PackageIndex", "Failed to write package index: " +
+                                                          std::string(e.what()),
+                                          "PackageIndex.cpp", __LINE__);
+        return false;
+    }
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+bool PackageIndex::GetPackage(std::string_view s_PackagePath,
+                              StringPool& c_StringPool,
+                              std::unique_ptr<Package>& p_Package) const noexcept
+{
+    auto Record = m_Record.find(s_PackagePath);
+    
+    if (Record == m_Record.end())
+    {
+        return false;
+    }
+    
+    try
+    {
+        Reader c_Reader(static_cast<const MRH_Uint8*>(p_Data), us_Size, Record->second);
+        std::string_view s_Path;
+        std::string_view s_ApplicationName;
+        std::vector<Package::SourceFile> v_SourceFile;
+        MRH_Uint32 u32_Count;
+        
+        if (c_Reader.Read(s_Path) == false ||
+            c_Reader.Read(s_ApplicationName) == false ||
+            c_Reader.Read(u32_Count) == false)
+        {
+            return false;
+        }
+        
+        for (MRH_Uint32 i = 0; i < u32_Count; ++i)
+        {
+            std::string_view s_SourcePath;
+            MRH_Uint64 u64_ModifiedNS;
+            MRH_Uint64 u64_Size;
+            
+            if (c_Reader.Read(s_SourcePath) == false ||
+                c_Reader.Read(u64_ModifiedNS) == false ||
+                c_Reader.Read(u64_Size) == false)
+            {
+                return false;
+            }
+            
+            v_SourceFile.emplace_back(c_StringPool.Add(s_SourcePath), u64_ModifiedNS, u64_Size);
+            
+            // Stop early, no need to read the rest
+            if (v_SourceFile.back().GetChanged() == true)
+            {
+                return false;
+            }
+            
+            // Source files are pairs of a locale directory and the 
+            // localised file, which depends on the current locale
+            if (i % 2 == 1)
+            {
+                std::string s_Directory(v_SourceFile[i - 1].s_Path);
+                std::string s_File(s_SourcePath.substr(s_SourcePath.rfind('/') + 1));
+                
+                if (Package::GetLocalisedPath(s_Directory, s_File) != s_SourcePath)
+                {
+                    return false;
+                }
+            }
+        }
+        
+        MRH_Uint32 u32_CompareMethod;
+        float f32_Similarity;
+        std::vector<LaunchTrigger::Trigger> v_Trigger;
+        
+        if (c_Reader.Read(u32_CompareMethod) == false || u32_CompareMethod > LaunchTrigger::COMPARE_METHOD_MAX ||
+            c_Reader.Read(f32_Similarity) == false ||
+            c_Reader.Read(u32_Count) == false)
+        {
+            return false;
+        }
+        
+        for (MRH_Uint32 i = 0; i < u32_Count; ++i)
+        {
+            LaunchTrigger::Trigger c_Trigger;
+            std::string_view s_String;
+            
+            if (c_Reader.Read(s_String) == false ||
+                c_Reader.Read(c_Trigger.u32_Weight) == false ||
+                c_Reader.Read(c_Trigger.s32_Value) == false)
+            {
+                return false;
+            }
+            
+            c_Trigger.s_String = s_String;
+            v_Trigger.emplace_back(std::move(c_Trigger));
+        }
+        
+        p_Package = std::make_unique<Package>(s_Path,
+                                              c_StringPool,
+                                              s_ApplicationName,
+                                              LaunchTrigger(static_cast<LaunchTrigger::CompareMethod>(u32_CompareMethod),
+                                                            f32_Similarity,
+                                                            std::move(v_Trigger)),
+                                              v_SourceFile);
+        return true;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+size_t PackageIndex::GetPackageCount() const noexcept
+{
+    return m_Record.size();
+}
@@ -0,0 +1,116 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef PackageIndex_h
+#define PackageIndex_h
+
+// C / C++
+#include <vector>
+#include <unordered_map>
+
+// External
+
+// Project
+#include "./TriggerTable.h"
+
+
+class PackageIndex
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor. The index file is mapped into memory, a missing 
+     *  or invalid index file results in an empty index.
+     *
+     *  \param s_FilePath The full path to the package index file.
+     */
+    
+    PackageIndex(std::string const& s_FilePath) noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~PackageIndex() noexcept;
+    
+    //*************************************************************************************
+    // Write
+    //*************************************************************************************
+    
+    /**
+     *  Write a package index file. The file is replaced atomically, missing 
+     *  parent directories are created.
+     *
+     *  \param s_FilePath The full path to the package index file.
+     *  \param v_Package The packages to write, indexed by package id.
+     *  \param c_TriggerTable The trigger table for all packages to write.
+     *
+     *  \return true if the index was written, false if not.
+     */
+    
+    static bool Write(std::string const& s_FilePath,
+                      std::vector<std::unique_ptr<Package>> const& v_Package,
+                      TriggerTable const& c_TriggerTable) noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get a indexed package. The package is only returned if none of 
+     *  its source files changed and its localised files still resolve 
+     *  to the same paths for the current locale.
+     *
+     *  \param s_PackagePath The full path to the package.
+     *  \param c_StringPool The pool to store the package strings in.
+     *  \param p_Package The package to set.
+     *
+     *  \return true if the package was set, false if not.
+     */
+    
+    bool GetPackage(std::string_view s_PackagePath,
+                    StringPool& c_StringPool,
+                    std::unique_ptr<Package>& p_Package) const noexcept;
+    
+    /**
+     *  Get the amount of indexed packages.
+     *
+     *  \return The indexed package count.
+     */
+    
+    size_t GetPackageCount() const noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    void* p_Data;
+    size_t us_Size;
+    
+    // <Package Path, Record Offset>, paths point into the mapped file
+    std::unordered_map<std::string_view, size_t> m_Record;
+    
+protected:
+    
+};
+
+#endif /* PackageIndex_h */
@@ -15,19 +15,70 @@
  */
 
 // C / C++
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 
 // External
-#include <libmrhbf.h>
 #include <libmrhab/Module/Tools/MRH_ModuleLogger.h>
 
 // Project
 #include "./PackageList.h"
+#include "./LoadReport.h"
+#include "./PackageListReader.h"
+#include "../Tools/WorkerPool.h"
+#include "../Tools/LocalisedPathCache.h"
 
 // Pre-defined
+#ifndef PACKAGE_LIST_LOAD_THREAD_MAX
+    #define PACKAGE_LIST_LOAD_THREAD_MAX 8
+#endif
+#ifndef PACKAGE_LIST_REPORT_SLOWEST
+    #define PACKAGE_LIST_REPORT_SLOWEST 5
+#endif
+#ifndef PACKAGE_LIST_TRIGGER_TREE
+    #define PACKAGE_LIST_TRIGGER_TREE 0 // BK-tree instead of q-gram index
+#endif
+#ifndef PACKAGE_LIST_POOL_COMPACT_FACTOR
+    #define PACKAGE_LIST_POOL_COMPACT_FACTOR 2 // Pool growth since the last compaction
+#endif
+
 namespace
 {
-    const char* p_BlockIdentifier = "Package";
-    const char* p_CountKey = "Count";
+    const char* p_PackageBlockIdentifier = "Package";
+    const char* p_SourceBlockIdentifier = "PackageSource";
+    
+    typedef std::chrono::steady_clock Clock;
+    
+    MRH_Uint64 GetNS(Clock::time_point c_Start) noexcept
+    {
+        return static_cast<MRH_Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - c_Start).count());
+    }
+    
+    void Report(LoadReport const& c_Report, Clock::time_point c_Start) noexcept
+    {
+        c_Report.Log(GetNS(c_Start), PACKAGE_LIST_REPORT_SLOWEST);
+        
+#ifdef PACKAGE_LIST_REPORT_PATH
+        c_Report.Write(PACKAGE_LIST_REPORT_PATH);
+#endif
+    }
+    
+    std::string GetCanonicalPath(std::string const& s_Path) noexcept
+    {
+        // Missing files keep their path, they fail to load later
+        char* p_Path = realpath(s_Path.c_str(), NULL);
+        
+        if (p_Path == NULL)
+        {
+            return s_Path;
+        }
+        
+        std::string s_Result(p_Path);
+        free(p_Path);
+        
+        return s_Result;
+    }
 }
 
 
@@ -35,67 +86,561 @@ namespace
 // Constructor / Destructor
 //*************************************************************************************
 
-PackageList::PackageList(std::string const& s_PackageListPath) noexcept
+PackageList::PackageList(std::vector<std::string> const& v_PackageListPath,
+                         std::string const& s_IndexPath,
+                         bool b_Lazy) noexcept : v_PackageListPath(v_PackageListPath),
+                                                 s_IndexPath(s_IndexPath),
+                                                 b_Lazy(b_Lazy),
+                                                 p_StringPool(std::make_unique<StringPool>()),
+                                                 us_PoolSize(0),
+                                                 b_PoolGarbage(false),
+                                                 b_TableValid(false)
+{
+    v_PackagePath = ReadPackageList();
+    LoadPackages({});
+}
+
+PackageList::~PackageList() noexcept
+{}
+
+//*************************************************************************************
+// Sources
+//*************************************************************************************
+
+std::vector<std::string> PackageList::ReadPackageSources(std::string const& s_FilePath,
+                                                         std::string const& s_DefaultPath) noexcept
+{
+    std::vector<std::string> v_Source;
+    
+    if (PackageListReader::Read(s_FilePath, p_SourceBlockIdentifier, v_Source) == false || v_Source.size() == 0)
+    {
+        MRH_ModuleLogger::Singleton().Log("PackageList", "No package sources in " +
+                                                         s_FilePath +
+                                                         ", using " +
+                                                         s_DefaultPath,
+                                          "PackageList.cpp", __LINE__);
+        return { s_DefaultPath };
+    }
+    
+    std::vector<std::string> v_Result;
+    std::set<std::string> s_Listed;
+    
+    for (auto& Source : v_Source)
+    {
+        // Keep the listed path, the canonical path only finds duplicates
+        if (s_Listed.insert(GetCanonicalPath(Source)).second == true)
+        {
+            v_Result.emplace_back(Source);
+        }
+    }
+    
+    return v_Result;
+}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+void PackageList::Update(bool b_ListChanged,
+                         std::set<std::string> const& s_Changed) noexcept
+{
+    if (b_ListChanged == true)
+    {
+        v_PackagePath = ReadPackageList();
+    }
+    
+    LoadPackages(s_Changed);
+}
+
+//*************************************************************************************
+// Load
+//*************************************************************************************
+
+std::vector<std::string> PackageList::ReadPackageList() const noexcept
 {
     MRH_ModuleLogger& c_Logger = MRH_ModuleLogger::Singleton();
-    c_Logger.Log("PackageList", "Reading " +
-                                 s_PackageListPath +
-                                 " package location config...",
-                 "PackageList.cpp", __LINE__);
+    std::vector<std::string> v_Result;
+    std::vector<std::string> v_Path;
+    std::set<std::string> s_Listed;
     
-    try
+    for (auto& List : v_PackageListPath)
+    {
+        c_Logger.Log("PackageList", "Reading " +
+                                    List +
+                                    " package location config...",
+                     "PackageList.cpp", __LINE__);
+        
+        v_Path.clear();
+        
+        if (PackageListReader::Read(List, p_PackageBlockIdentifier, v_Path) == false)
+        {
+            c_Logger.Log("PackageList", "Failed to load package list " +
+                                        List,
+                         "PackageList.cpp", __LINE__);
+            continue;
+        }
+        
+        try
+        {
+            for (auto& Path : v_Path)
+            {
+                // Different paths might point to the same package, the 
+                // listed path is used since the platform launches by it
+                if (s_Listed.insert(GetCanonicalPath(Path)).second == true)
+                {
+                    v_Result.emplace_back(Path);
+                }
+            }
+        }
+        catch (std::exception& e)
+        {
+            c_Logger.Log("PackageList", "Failed to load package list " +
+                                        List +
+                                        ": " +
+                                        e.what(),
+                         "PackageList.cpp", __LINE__);
+        }
+    }
+    
+    return v_Result;
+}
+
+void PackageList::LoadPackages(std::set<std::string> const& s_Changed) noexcept
+{
+    // Load new and changed packages only, listed paths are unique
+    std::vector<std::string> v_LoadPath;
+    
+    for (auto& Path : v_PackagePath)
+    {
+        if (m_PackageID.count(Path) == 0 || s_Changed.count(Path) > 0)
+        {
+            // Locale directories might have changed as well
+            LocalisedPathCache::Singleton().Invalidate(Path);
+            v_LoadPath.emplace_back(Path);
+        }
+    }
+    
+    Clock::time_point c_Start = Clock::now();
+    PackageIndex c_Index(b_Lazy == false ? s_IndexPath : "");
+    std::vector<std::unique_ptr<Package>> v_Loaded(v_LoadPath.size());
+    LoadReport c_Report;
+    size_t us_Indexed = LoadPackages(v_LoadPath, v_Loaded, c_Index, c_Report);
+    
+    Report(c_Report, c_Start);
+    
+    // Assign ids, reloaded packages keep their id
+    std::unordered_map<std::string, Package::ID> m_Listed;
+    size_t us_Removed = 0;
+    
+    for (size_t i = 0; i < v_LoadPath.size(); ++i)
+    {
+        if (v_Loaded[i] == nullptr)
+        {
+            continue;
+        }
+        
+        Package::ID u32_PackageID;
+        auto Current = m_PackageID.find(v_LoadPath[i]);
+        
+        if (Current != m_PackageID.end())
+        {
+            u32_PackageID = Current->second;
+        }
+        else if (v_FreeID.size() > 0)
+        {
+            u32_PackageID = v_FreeID.back();
+            v_FreeID.pop_back();
+        }
+        else
+        {
+            u32_PackageID = static_cast<Package::ID>(v_Package.size());
+            v_Package.emplace_back();
+            v_InTable.emplace_back(false);
+        }
+        
+        v_Package[u32_PackageID] = std::move(v_Loaded[i]);
+        v_InTable[u32_PackageID] = false;
+        m_Listed[v_LoadPath[i]] = u32_PackageID;
+    }
+    
+    v_Order.clear();
+    
+    for (auto& Path : v_PackagePath)
     {
-        MRH_BlockFile c_File(s_PackageListPath);
+        auto Listed = m_Listed.find(Path);
         
-        for (auto& Block : c_File.l_Block)
+        if (Listed == m_Listed.end())
         {
-            if (Block.GetName().compare(p_BlockIdentifier) != 0)
+            // Unchanged packages are kept
+            auto Current = m_PackageID.find(Path);
+            
+            if (Current == m_PackageID.end() || s_Changed.count(Path) > 0)
             {
                 continue;
             }
             
-            // Grab the count first
-            MRH_Uint32 u32_Count = static_cast<MRH_Uint32>(std::stoull(Block.GetValue(p_CountKey)));
+            Listed = m_Listed.emplace(Path, Current->second).first;
+        }
+        
+        v_Order.emplace_back(Listed->second);
+    }
+    
+    // Removed packages and packages which failed to reload are still 
+    // used by the current table, their ids are freed once it is replaced
+    for (auto& Current : m_PackageID)
+    {
+        auto Listed = m_Listed.find(Current.first);
+        
+        if (Listed == m_Listed.end() || Listed->second != Current.second)
+        {
+            v_RemovedID.emplace_back(Current.second);
+            ++us_Removed;
+        }
+    }
+    
+    m_PackageID.swap(m_Listed);
+    b_TableValid = false;
+    
+    // Strings of replaced and removed packages stay in the pool
+    if (s_Changed.size() > 0 || us_Removed > 0)
+    {
+        b_PoolGarbage = true;
+    }
+    
+    MRH_ModuleLogger::Singleton().Log("PackageList", "Loaded " +
+                                                     std::to_string(v_LoadPath.size()) +
+                                                     " packages (" +
+                                                     std::to_string(us_Indexed) +
+                                                     " from index, " +
+                                                     std::to_string(m_PackageID.size()) +
+                                                     " total, " +
+                                                     std::to_string(p_StringPool->GetSize()) +
+                                                     " string bytes)",
+                                      "PackageList.cpp", __LINE__);
+    
+    // Lazy packages are only added to the trigger table on use
+    if (b_Lazy == true)
+    {
+        return;
+    }
+    
+    BuildTriggerTable();
+    
+    // Rewrite the index if anything changed, an outdated table would 
+    // write removed packages
+    if (b_TableValid == true &&
+        (us_Indexed != v_LoadPath.size() || us_Removed > 0 || c_Index.GetPackageCount() != m_PackageID.size()))
+    {
+        PackageIndex::Write(s_IndexPath, v_Package, c_TriggerTable);
+    }
+}
+
+size_t PackageList::LoadPackages(std::vector<std::string> const& v_PackagePath,
+                                 std::vector<std::unique_ptr<Package>>& v_Loaded,
+                                 PackageIndex const& c_Index,
+                                 LoadReport& c_Report) noexcept
+{
+    if (b_Lazy == true)
+    {
+        // Only record paths, packages load themselves on access
+        for (size_t i = 0; i < v_PackagePath.size(); ++i)
+        {
+            try
+            {
+                v_Loaded[i] = std::make_unique<Package>(v_PackagePath[i], *p_StringPool, true);
+            }
+            catch (...)
+            {}
+        }
+        
+        return 0;
+    }
+    
+    std::atomic<size_t> us_Indexed(0);
+    std::vector<std::string> v_Error(v_PackagePath.size());
+    std::vector<MRH_Uint64> v_TotalNS(v_PackagePath.size(), 0);
+    std::vector<MRH_Uint8> v_Indexed(v_PackagePath.size(), 0);
+    
+    WorkerPool c_Pool(WorkerPool::GetWorkerCount(PACKAGE_LIST_LOAD_THREAD_MAX, v_PackagePath.size()));
+    
+    c_Pool.Run(v_PackagePath.size(), [&](size_t us_Index)
+    {
+        Clock::time_point c_Start = Clock::now();
+        
+        try
+        {
+            if (c_Index.GetPackage(v_PackagePath[us_Index], *p_StringPool, v_Loaded[us_Index]) == true)
+            {
+                ++us_Indexed;
+                v_Indexed[us_Index] = 1;
+            }
+            else
+            {
+                v_Loaded[us_Index] = std::make_unique<Package>(v_PackagePath[us_Index], *p_StringPool, false);
+            }
+        }
+        catch (std::exception& e) // Catch all
+        {
+            v_Error[us_Index] = e.what();
+        }
+        
+        v_TotalNS[us_Index] = GetNS(c_Start);
+    });
+    
+    // Log failures, failed loads are timed as well
+    MRH_ModuleLogger& c_Logger = MRH_ModuleLogger::Singleton();
+    
+    for (size_t i = 0; i < v_PackagePath.size(); ++i)
+    {
+        if (v_Loaded[i] == nullptr)
+        {
+            c_Logger.Log("PackageList", "Failed to load package " +
+                                        v_PackagePath[i] +
+                                        ": " +
+                                        v_Error[i],
+                         "PackageList.cpp", __LINE__);
+            
+            c_Report.Add(v_PackagePath[i], { 0, 0, 0 }, v_TotalNS[i], false, true);
+        }
+        else
+        {
+            c_Report.Add(v_PackagePath[i], v_Loaded[i]->GetLoadTime(), v_TotalNS[i], v_Indexed[i] != 0, false);
+        }
+    }
+    
+    return us_Indexed;
+}
+
+void PackageList::BuildTriggerTable() noexcept
+{
+    if (b_TableValid == true)
+    {
+        return;
+    }
+    
+    // Find packages which are missing from the current table
+    std::vector<size_t> v_Position(v_Package.size(), c_TriggerTable.GetPackageCount());
+    std::vector<Package::ID> v_Missing;
+    
+    for (size_t i = 0; i < c_TriggerTable.GetPackageCount(); ++i)
+    {
+        Package::ID u32_PackageID = c_TriggerTable.GetPackageID(i);
+        
+        if (u32_PackageID < v_Position.size() && v_InTable[u32_PackageID] == true)
+        {
+            v_Position[u32_PackageID] = i;
+        }
+    }
+    
+    for (auto& PackageID : m_PackageID)
+    {
+        if (v_InTable[PackageID.second] == false)
+        {
+            v_Missing.emplace_back(PackageID.second);
+        }
+    }
+    
+    // Lazy packages load on trigger access, do that concurrently. Unchanged 
+    // packages are taken from the package index instead of their files
+    size_t us_Indexed = 0;
+    size_t us_IndexCount = 0;
+    
+    if (b_Lazy == true && v_Missing.size() > 0)
+    {
+        Clock::time_point c_Start = Clock::now();
+        PackageIndex c_Index(s_IndexPath);
+        std::vector<std::unique_ptr<Package>> v_Indexed(v_Missing.size());
+        std::vector<MRH_Uint64> v_TotalNS(v_Missing.size(), 0);
+        WorkerPool c_Pool(WorkerPool::GetWorkerCount(PACKAGE_LIST_LOAD_THREAD_MAX, v_Missing.size()));
+        
+        c_Pool.Run(v_Missing.size(), [&](size_t us_Index)
+        {
+            Clock::time_point c_PackageStart = Clock::now();
+            Package const& c_Package = *(v_Package[v_Missing[us_Index]]);
             
-            // Now read the packages
-            MRH_ValueBlock::ValueList l_Value = Block.GetValues();
+            if (c_Index.GetPackage(c_Package.GetPackagePath(), *p_StringPool, v_Indexed[us_Index]) == false)
+            {
+                c_Package.GetLaunchTrigger();
+            }
             
-            for (auto& Value : l_Value)
+            v_TotalNS[us_Index] = GetNS(c_PackageStart);
+        });
+        
+        // Missing packages are not in any table yet, nothing refers 
+        // to the replaced lazy packages
+        LoadReport c_Report;
+        
+        for (size_t i = 0; i < v_Missing.size(); ++i)
+        {
+            bool b_Indexed = (v_Indexed[i] != nullptr);
+            
+            if (b_Indexed == true)
             {
-                try
-                {
-                    if (std::stoull(Value.first) < u32_Count && Value.second.size() > 0)
-                    {
-                        l_Package.emplace_back(Value.second);
-                    }
-                }
-                catch (std::exception& e) // Catch all
-                {
-                    c_Logger.Log("PackageList", "Failed to load package " +
-                                                Value.second +
-                                                ": " +
-                                                e.what(),
-                                 "PackageList.cpp", __LINE__);
-                }
+                v_Package[v_Missing[i]] = std::move(v_Indexed[i]);
+                ++us_Indexed;
             }
+            
+            // Failed lazy packages have no name
+            Package const& c_Package = *(v_Package[v_Missing[i]]);
+            
+            c_Report.Add(std::string(c_Package.GetPackagePath()),
+                         c_Package.GetLoadTime(),
+                         v_TotalNS[i],
+                         b_Indexed,
+                         c_Package.GetApplicationName().size() == 0);
+        }
+        
+        us_IndexCount = c_Index.GetPackageCount();
+        Report(c_Report, c_Start);
+    }
+    
+    // The pool only grows, move all used strings to a new pool once 
+    // enough were left behind by replaced and removed packages
+    bool b_Compact = (b_PoolGarbage == true && 
+                      us_PoolSize > 0 &&
+                      p_StringPool->GetSize() >= us_PoolSize * PACKAGE_LIST_POOL_COMPACT_FACTOR);
+    std::unique_ptr<StringPool> p_Pool;
+    std::vector<std::unique_ptr<Package>> v_Compacted;
+    
+    try
+    {
+        if (b_Compact == true)
+        {
+            p_Pool = std::make_unique<StringPool>();
+            v_Compacted.resize(v_Package.size());
+            
+            for (auto& PackageID : m_PackageID)
+            {
+                v_Compacted[PackageID.second] = std::make_unique<Package>(*(v_Package[PackageID.second]), *p_Pool);
+            }
+        }
+        
+        StringPool& c_Pool = (b_Compact == true ? *p_Pool : *p_StringPool);
+        std::vector<std::unique_ptr<Package>> const& v_Current = (b_Compact == true ? v_Compacted : v_Package);
+        TriggerTable c_Table;
+        
+        for (auto& PackageID : v_Order)
+        {
+            if (v_InTable[PackageID] == false || v_Position[PackageID] >= c_TriggerTable.GetPackageCount())
+            {
+                c_Table.Add(PackageID, v_Current[PackageID]->GetLaunchTrigger(), c_Pool);
+            }
+            else if (b_Compact == true)
+            {
+                c_Table.Add(c_TriggerTable, v_Position[PackageID], c_Pool);
+            }
+            else
+            {
+                c_Table.Add(c_TriggerTable, v_Position[PackageID]);
+            }
+        }
+        
+#if PACKAGE_LIST_TRIGGER_TREE > 0
+        TriggerTree c_Tree(c_Table);
+#else
+        TriggerIndex c_Index(c_Table);
+#endif
+        TriggerHash c_Hash(c_Table);
+        NameIndex c_Name(c_Table, v_Current);
+        
+        c_TriggerTable = std::move(c_Table);
+#if PACKAGE_LIST_TRIGGER_TREE > 0
+        c_TriggerTree = std::move(c_Tree);
+#else
+        c_TriggerIndex = std::move(c_Index);
+#endif
+        c_TriggerHash = std::move(c_Hash);
+        c_NameIndex = std::move(c_Name);
+        
+        // The old packages and pool are destroyed with the locals, 
+        // nothing refers to them anymore
+        if (b_Compact == true)
+        {
+            v_Package.swap(v_Compacted);
+            p_StringPool.swap(p_Pool);
         }
     }
     catch (std::exception& e)
     {
-        c_Logger.Log("PackageList", "Failed to load package list: " +
-                                   std::string(e.what()),
-                     "PackageList.cpp", __LINE__);
+        MRH_ModuleLogger::Singleton().Log("PackageList", "Failed to build trigger table: " +
+                                                         std::string(e.what()),
+                                          "PackageList.cpp", __LINE__);
+        return;
+    }
+    
+    // The table owns the trigger data now
+    for (auto& PackageID : v_Missing)
+    {
+        v_Package[PackageID]->ReleaseLaunchTrigger();
+        v_InTable[PackageID] = true;
+    }
+    
+    // No table refers to removed packages anymore
+    for (auto& PackageID : v_RemovedID)
+    {
+        v_Package[PackageID].reset();
+        v_InTable[PackageID] = false;
+        v_FreeID.emplace_back(PackageID);
+    }
+    
+    v_RemovedID.clear();
+    
+    if (b_Compact == true || us_PoolSize == 0)
+    {
+        us_PoolSize = p_StringPool->GetSize();
+        b_PoolGarbage = false;
+    }
+    
+    b_TableValid = true;
+    
+    // Lazy loading writes the index once the missing packages were loaded
+    if (b_Lazy == true && v_Missing.size() > 0 &&
+        (us_Indexed != v_Missing.size() || us_IndexCount != m_PackageID.size()))
+    {
+        PackageIndex::Write(s_IndexPath, v_Package, c_TriggerTable);
     }
 }
 
-PackageList::~PackageList() noexcept
-{}
-
 //*************************************************************************************
 // Getters
 //*************************************************************************************
 
-std::list<Package> const& PackageList::GetPackages() const noexcept
+TriggerTable const& PackageList::GetTriggerTable() noexcept
+{
+    BuildTriggerTable();
+    return c_TriggerTable;
+}
+
+void PackageList::GetCandidates(std::string_view s_Input,
+                                std::vector<size_t>& v_Position)
+{
+    BuildTriggerTable();
+    
+#if PACKAGE_LIST_TRIGGER_TREE > 0
+    c_TriggerTree.GetCandidates(s_Input, v_Position);
+#else
+    c_TriggerIndex.GetCandidates(s_Input, v_Position);
+#endif
+}
+
+TriggerHash const& PackageList::GetTriggerHash() noexcept
+{
+    BuildTriggerTable();
+    return c_TriggerHash;
+}
+
+NameIndex const& PackageList::GetNameIndex() noexcept
+{
+    BuildTriggerTable();
+    return c_NameIndex;
+}
+
+Package const& PackageList::GetPackage(Package::ID u32_PackageID) const noexcept
+{
+    return *(v_Package[u32_PackageID]);
+}
+
+std::vector<std::string> const& PackageList::GetPackagePaths() const noexcept
 {
-    return l_Package;
+    return v_PackagePath;
 }
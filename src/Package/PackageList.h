@@ -18,12 +18,20 @@
 #define PackageList_h
 
 // C / C++
-#include <list>
+#include <vector>
+#include <set>
+#include <unordered_map>
 
 // External
 
 // Project
-#include "./Package.h"
+#include "./PackageIndex.h"
+#include "./TriggerTable.h"
+#include "./TriggerIndex.h"
+#include "./TriggerTree.h"
+#include "./TriggerHash.h"
+#include "./NameIndex.h"
+#include "./LoadReport.h"
 
 
 class PackageList
@@ -37,10 +45,18 @@ public:
     /**
      *  Default constructor.
      *
-     *  \param s_PackageListPath The full path to the package list file.
+     *  \param v_PackageListPath The full paths to all package list files. 
+     *                           Packages listed more than once are only 
+     *                           loaded for the first listing.
+     *  \param s_IndexPath The full path to the package index file.
+     *  \param b_Lazy If package data should only be loaded on first access.
+     *                Lazy packages are taken from the package index on 
+     *                first access if unchanged.
      */
     
-    PackageList(std::string const& s_PackageListPath) noexcept;
+    PackageList(std::vector<std::string> const& v_PackageListPath,
+                std::string const& s_IndexPath,
+                bool b_Lazy) noexcept;
     
     /**
      *  Default destructor.
@@ -48,25 +64,184 @@ public:
     
     ~PackageList() noexcept;
     
+    //*************************************************************************************
+    // Sources
+    //*************************************************************************************
+    
+    /**
+     *  Read the package list files to use from a package source file. 
+     *  Duplicate package lists are removed by their canonical path.
+     *
+     *  \param s_FilePath The full path to the package source file.
+     *  \param s_DefaultPath The full path to the package list file to use 
+     *                       if no sources are defined.
+     *
+     *  \return The full paths to all package list files.
+     */
+    
+    static std::vector<std::string> ReadPackageSources(std::string const& s_FilePath,
+                                                       std::string const& s_DefaultPath) noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Update the package list. Unchanged packages are kept, new and changed 
+     *  packages are loaded and removed packages are dropped. Kept and changed 
+     *  packages keep their package id.
+     *
+     *  \param b_ListChanged If the package list file changed.
+     *  \param s_Changed The full paths of all changed packages.
+     */
+    
+    void Update(bool b_ListChanged,
+                std::set<std::string> const& s_Changed) noexcept;
+    
     //*************************************************************************************
     // Getters
     //*************************************************************************************
     
     /**
-     *  Get the packages.
+     *  Get the trigger table for all packages, in package list order. Lazy 
+     *  packages are loaded on first access.
+     *
+     *  \return The trigger table.
+     */
+    
+    TriggerTable const& GetTriggerTable() noexcept;
+    
+    /**
+     *  Get the packages which might match a input. Packages which are not 
+     *  returned are guaranteed to not match. This function is not thread 
+     *  safe.
+     *
+     *  \param s_Input The normalised input to match.
+     *  \param v_Position The package positions in the trigger table, in 
+     *                    ascending order.
+     */
+    
+    void GetCandidates(std::string_view s_Input,
+                       std::vector<size_t>& v_Position);
+    
+    /**
+     *  Get the trigger hash for the current trigger table.
      *
-     *  \return The packages.
+     *  \return The trigger hash.
      */
     
-    std::list<Package> const& GetPackages() const noexcept;
+    TriggerHash const& GetTriggerHash() noexcept;
+    
+    /**
+     *  Get the application name index for the current trigger table.
+     *
+     *  \return The name index.
+     */
+    
+    NameIndex const& GetNameIndex() noexcept;
+    
+    /**
+     *  Get a package.
+     *
+     *  \param u32_PackageID The id of the package. The id has to be taken 
+     *                       from the current trigger table.
+     *
+     *  \return The package.
+     */
+    
+    Package const& GetPackage(Package::ID u32_PackageID) const noexcept;
+    
+    /**
+     *  Get the full paths of all listed packages, including packages which 
+     *  failed to load.
+     *
+     *  \return The listed package paths.
+     */
+    
+    std::vector<std::string> const& GetPackagePaths() const noexcept;
     
 private:
     
+    //*************************************************************************************
+    // Load
+    //*************************************************************************************
+    
+    /**
+     *  Read the package paths from all package list files. Each package 
+     *  is only listed once by its canonical path, the first listed path 
+     *  is kept.
+     *
+     *  \return The full paths of all listed packages.
+     */
+    
+    std::vector<std::string> ReadPackageList() const noexcept;
+    
+    /**
+     *  Load all listed packages which are new or changed.
+     *
+     *  \param s_Changed The full paths of all changed packages.
+     */
+    
+    void LoadPackages(std::set<std::string> const& s_Changed) noexcept;
+    
+    /**
+     *  Load packages concurrently. Unchanged packages are taken from the 
+     *  package index, packages which failed to load are logged.
+     *
+     *  \param v_PackagePath The full paths of the packages to load.
+     *  \param v_Loaded The loaded packages, in the order of the given paths. 
+     *                  Failed packages are left empty.
+     *  \param c_Index The package index to use.
+     *  \param c_Report The report to add the package load times to.
+     *
+     *  \return The amount of packages taken from the index.
+     */
+    
+    size_t LoadPackages(std::vector<std::string> const& v_PackagePath,
+                        std::vector<std::unique_ptr<Package>>& v_Loaded,
+                        PackageIndex const& c_Index,
+                        LoadReport& c_Report) noexcept;
+    
+    /**
+     *  Rebuild the trigger table if outdated. Unchanged packages are 
+     *  copied from the current table.
+     */
+    
+    void BuildTriggerTable() noexcept;
+    
     //*************************************************************************************
     // Data
     //*************************************************************************************
     
-    std::list<Package> l_Package;
+    std::vector<std::string> v_PackageListPath;
+    std::string s_IndexPath;
+    bool b_Lazy;
+    
+    // Owns all package and trigger strings, has to outlive both. 
+    // Replaced by a compacted pool when the trigger table is rebuilt
+    std::unique_ptr<StringPool> p_StringPool;
+    size_t us_PoolSize; // Pool size after the last compaction
+    bool b_PoolGarbage; // Replaced or removed package strings in the pool
+    
+    std::vector<std::string> v_PackagePath;
+    
+    // Cold package data, indexed by package id
+    std::vector<std::unique_ptr<Package>> v_Package;
+    std::vector<bool> v_InTable;
+    std::vector<Package::ID> v_FreeID;
+    std::vector<Package::ID> v_RemovedID; // Kept until the table is rebuilt
+    std::unordered_map<std::string, Package::ID> m_PackageID;
+    
+    // Package ids in package list order
+    std::vector<Package::ID> v_Order;
+    
+    // Hot trigger data, in package list order
+    TriggerTable c_TriggerTable;
+    TriggerIndex c_TriggerIndex;
+    TriggerTree c_TriggerTree;
+    TriggerHash c_TriggerHash;
+    NameIndex c_NameIndex;
+    bool b_TableValid;
     
 protected:
     
@@ -0,0 +1,317 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <cstdio>
+
+// External
+#include <libmrhab/Module/Tools/MRH_ModuleLogger.h>
+
+// Project
+#include "./PackageListReader.h"
+
+// Pre-defined
+#ifndef PACKAGE_LIST_READER_BUFFER_SIZE
+    #define PACKAGE_LIST_READER_BUFFER_SIZE 16384
+#endif
+
+namespace
+{
+    const char* p_CountKey = "Count";
+    
+    bool ParseIndex(std::string const& s_String, MRH_Uint32& u32_Index) noexcept
+    {
+        if (s_String.size() == 0)
+        {
+            return false;
+        }
+        
+        MRH_Uint64 u64_Index = 0;
+        
+        for (char c : s_String)
+        {
+            if (c < '0' || c > '9')
+            {
+                return false;
+            }
+            
+            u64_Index = (u64_Index * 10) + static_cast<MRH_Uint64>(c - '0');
+            
+            if (u64_Index > 0xFFFFFFFFULL)
+            {
+                return false;
+            }
+        }
+        
+        u32_Index = static_cast<MRH_Uint32>(u64_Index);
+        return true;
+    }
+    
+    class Block
+    {
+    public:
+        
+        Block(std::string const& s_FilePath,
+              std::vector<std::string>& v_Path) noexcept : s_FilePath(s_FilePath),
+                                                           v_Path(v_Path),
+                                                           us_Start(v_Path.size()),
+                                                           b_CountSet(false),
+                                                           u32_Count(0)
+        {}
+        
+        void Begin() noexcept
+        {
+            us_Start = v_Path.size();
+            b_CountSet = false;
+            u32_Count = 0;
+            v_Index.clear();
+        }
+        
+        void Add(std::string const& s_Key, std::string& s_Value)
+        {
+            MRH_Uint32 u32_Index;
+            
+            if (s_Key.compare(p_CountKey) == 0)
+            {
+                if (ParseIndex(s_Value, u32_Count) == false)
+                {
+                    Log("Invalid count " + s_Value);
+                    return;
+                }
+                
+                b_CountSet = true;
+                Filter();
+            }
+            else if (ParseIndex(s_Key, u32_Index) == false)
+            {
+                Log("Invalid key " + s_Key);
+            }
+            else if (s_Value.size() == 0)
+            {
+                return;
+            }
+            else if (b_CountSet == true)
+            {
+                // Count known, filter in place
+                if (u32_Index < u32_Count)
+                {
+                    v_Path.emplace_back(std::move(s_Value));
+                }
+            }
+            else
+            {
+                // Count comes later, keep the index for filtering
+                v_Path.emplace_back(std::move(s_Value));
+                v_Index.emplace_back(u32_Index);
+            }
+        }
+        
+        void End() noexcept
+        {
+            if (b_CountSet == false)
+            {
+                Drop("Missing count, block ignored");
+            }
+        }
+        
+        void Drop(std::string const& s_Message) noexcept
+        {
+            Log(s_Message);
+            v_Path.resize(us_Start);
+            v_Index.clear();
+        }
+        
+    private:
+        
+        void Filter() noexcept
+        {
+            if (v_Index.size() == 0)
+            {
+                return;
+            }
+            
+            size_t us_Kept = us_Start;
+            
+            for (size_t i = 0; i < v_Index.size(); ++i)
+            {
+                if (v_Index[i] < u32_Count)
+                {
+                    if (us_Kept != us_Start + i)
+                    {
+                        v_Path[us_Kept] = std::move(v_Path[us_Start + i]);
+                    }
+                    
+                    ++us_Kept;
+                }
+            }
+            
+            v_Path.resize(us_Kept);
+            v_Index.clear();
+        }
+        
+        void Log(std::string const& s_Message) noexcept
+        {
+            MRH_ModuleLogger::Singleton().Log("PackageListReader", s_FilePath +
+                                                                   ": " +
+                                                                   s_Message,
+                                              "PackageListReader.cpp", __LINE__);
+        }
+        
+        std::string const& s_FilePath;
+        std::vector<std::string>& v_Path;
+        size_t us_Start;
+        
+        bool b_CountSet;
+        MRH_Uint32 u32_Count;
+        std::vector<MRH_Uint32> v_Index;
+    };
+}
+
+
+//*************************************************************************************
+// Read
+//*************************************************************************************
+
+bool PackageListReader::Read(std::string const& s_FilePath,
+                             std::string_view s_BlockName,
+                             std::vector<std::string>& v_Path) noexcept
+{
+    FILE* p_File = std::fopen(s_FilePath.c_str(), "r");
+    
+    if (p_File == NULL)
+    {
+        return false;
+    }
+    
+    char p_Buffer[PACKAGE_LIST_READER_BUFFER_SIZE];
+    size_t us_Read;
+    bool b_Result = true;
+    
+    // Tokens are <...>, blocks are <Name>{ <Key><Value> ... }, 
+    // comments run from # to the line end outside of tokens
+    std::string s_Token;
+    std::string s_Name;
+    std::string s_Key;
+    bool b_InComment = false;
+    bool b_InToken = false;
+    bool b_InBlock = false;
+    bool b_Match = false;
+    bool b_KeySet = false;
+    Block c_Block(s_FilePath, v_Path);
+    
+    try
+    {
+        while ((us_Read = std::fread(p_Buffer, 1, sizeof(p_Buffer), p_File)) > 0)
+        {
+            for (size_t i = 0; i < us_Read; ++i)
+            {
+                char c = p_Buffer[i];
+                
+                if (b_InComment == true)
+                {
+                    b_InComment = (c != '\n');
+                }
+                else if (b_InToken == true)
+                {
+                    if (c != '>')
+                    {
+                        // Skipped blocks only need their end
+                        if (b_InBlock == false || b_Match == true)
+                        {
+                            s_Token += c;
+                        }
+                        
+                        continue;
+                    }
+                    
+                    b_InToken = false;
+                    
+                    if (b_InBlock == false)
+                    {
+                        s_Name.swap(s_Token);
+                    }
+                    else if (b_Match == false)
+                    {}
+                    else if (b_KeySet == false)
+                    {
+                        s_Key.swap(s_Token);
+                        b_KeySet = true;
+                    }
+                    else
+                    {
+                        c_Block.Add(s_Key, s_Token);
+                        b_KeySet = false;
+                    }
+                    
+                    s_Token.clear();
+                }
+                else if (c == '#')
+                {
+                    b_InComment = true;
+                }
+                else if (c == '<')
+                {
+                    b_InToken = true;
+                }
+                else if (c == '{' && b_InBlock == false)
+                {
+                    b_InBlock = true;
+                    b_Match = (s_BlockName.compare(s_Name) == 0);
+                    b_KeySet = false;
+                    
+                    if (b_Match == true)
+                    {
+                        c_Block.Begin();
+                    }
+                }
+                else if (c == '}' && b_InBlock == true)
+                {
+                    if (b_Match == true)
+                    {
+                        c_Block.End();
+                    }
+                    
+                    b_InBlock = false;
+                    s_Name.clear();
+                }
+            }
+        }
+    }
+    catch (std::exception& e)
+    {
+        MRH_ModuleLogger::Singleton().Log("PackageListReader", "Failed to read " +
+                                                               s_FilePath +
+                                                               ": " +
+                                                               e.what(),
+                                          "PackageListReader.cpp", __LINE__);
+        b_Result = false;
+    }
+    
+    if (std::ferror(p_File) != 0)
+    {
+        b_Result = false;
+    }
+    
+    std::fclose(p_File);
+    
+    // Unterminated blocks are incomplete
+    if (b_InBlock == true && b_Match == true)
+    {
+        c_Block.Drop("Unterminated block ignored");
+    }
+    
+    return b_Result;
+}
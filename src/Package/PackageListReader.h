@@ -0,0 +1,59 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef PackageListReader_h
+#define PackageListReader_h
+
+// C / C++
+#include <string>
+#include <string_view>
+#include <vector>
+
+// External
+
+// Project
+
+
+namespace PackageListReader
+{
+    //*************************************************************************************
+    // Read
+    //*************************************************************************************
+    
+    /**
+     *  Read the indexed paths of all blocks with the given name from a block 
+     *  file. The file is read once without building a block tree. A block 
+     *  has to define a count, only paths with an index below the count are 
+     *  used. Invalid entries are logged and skipped.
+     *
+     *  The accepted format is the block file subset used by package lists: 
+     *  <Name>{ ... } blocks without nesting, containing <Key><Value> pairs. 
+     *  Values are taken verbatim up to the next '>' and may span lines. 
+     *  Outside of values, a '#' starts a comment which ends with the line.
+     *
+     *  \param s_FilePath The full path to the block file.
+     *  \param s_BlockName The name of the blocks to read.
+     *  \param v_Path The vector to add the paths to, in file order.
+     *
+     *  \return true if the file was read, false if not.
+     */
+    
+    bool Read(std::string const& s_FilePath,
+              std::string_view s_BlockName,
+              std::vector<std::string>& v_Path) noexcept;
+}
+
+#endif /* PackageListReader_h */
@@ -0,0 +1,279 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <cerrno>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/inotify.h>
+
+// External
+#include <libmrhab/Module/Tools/MRH_ModuleLogger.h>
+
+// Project
+#include "./PackageWatch.h"
+
+// Pre-defined
+#ifndef PACKAGE_LAUNCH_TRIGGER_DIRECTORY
+    #define PACKAGE_LAUNCH_TRIGGER_DIRECTORY "LaunchTrigger"
+#endif
+#ifndef PACKAGE_APPLICATION_NAME_DIRECTORY
+    #define PACKAGE_APPLICATION_NAME_DIRECTORY "ApplicationName"
+#endif
+
+namespace
+{
+    constexpr MRH_Uint32 u32_ListMask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE;
+    constexpr MRH_Uint32 u32_PackageMask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE | IN_DELETE_SELF | IN_MOVE_SELF;
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+PackageWatch::PackageWatch(std::vector<std::string> const& v_PackageListPath) noexcept : i_FD(-1),
+                                                                                         b_LimitReached(false)
+{
+    i_FD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    
+    if (i_FD < 0)
+    {
+        MRH_ModuleLogger::Singleton().Log("PackageWatch", "Failed to create inotify instance, packages are not watched!",
+                                          "PackageWatch.cpp", __LINE__);
+        return;
+    }
+    
+    for (auto& Path : v_PackageListPath)
+    {
+        // Files get replaced by editors and package managers, watch the
+        // directory instead of the file itself
+        size_t us_Separator = Path.find_last_of('/');
+        std::string s_Directory;
+        std::string s_File;
+        
+        if (us_Separator == std::string::npos)
+        {
+            s_Directory = ".";
+            s_File = Path;
+        }
+        else
+        {
+            s_Directory = Path.substr(0, us_Separator > 0 ? us_Separator : 1);
+            s_File = Path.substr(us_Separator + 1);
+        }
+        
+        // Lists in the same directory share a watch descriptor
+        int i_WD = inotify_add_watch(i_FD, s_Directory.c_str(), u32_ListMask);
+        
+        if (i_WD < 0)
+        {
+            MRH_ModuleLogger::Singleton().Log("PackageWatch", "Failed to watch package list " +
+                                                              Path,
+                                              "PackageWatch.cpp", __LINE__);
+            continue;
+        }
+        
+        m_List[i_WD].insert(s_File);
+    }
+}
+
+PackageWatch::~PackageWatch() noexcept
+{
+    if (i_FD >= 0)
+    {
+        close(i_FD);
+    }
+}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+void PackageWatch::SetPackages(std::vector<std::string> const& v_PackagePath,
+                               std::set<std::string> const& s_Changed) noexcept
+{
+    if (i_FD < 0)
+    {
+        return;
+    }
+    
+    std::set<std::string> s_Listed(v_PackagePath.begin(), v_PackagePath.end());
+    
+    // Remove old first, changed packages might have new directories
+    for (auto It = m_Package.begin(); It != m_Package.end();)
+    {
+        if (s_Listed.count(It->first) == 0 || s_Changed.count(It->first) > 0)
+        {
+            std::string s_PackagePath = It->first;
+            ++It;
+            
+            RemoveWatches(s_PackagePath);
+        }
+        else
+        {
+            ++It;
+        }
+    }
+    
+    for (auto& Package : s_Listed)
+    {
+        if (m_Package.count(Package) > 0)
+        {
+            continue;
+        }
+        
+        m_Package[Package];
+        
+        AddWatch(Package, Package + "/" + PACKAGE_LAUNCH_TRIGGER_DIRECTORY, true);
+        AddWatch(Package, Package + "/" + PACKAGE_APPLICATION_NAME_DIRECTORY, true);
+    }
+}
+
+//*************************************************************************************
+// Watch
+//*************************************************************************************
+
+void PackageWatch::AddWatch(std::string const& s_PackagePath,
+                            std::string const& s_Directory,
+                            bool b_Recursive) noexcept
+{
+    int i_WD = inotify_add_watch(i_FD, s_Directory.c_str(), u32_PackageMask | IN_ONLYDIR);
+    
+    if (i_WD < 0)
+    {
+        if (errno == ENOSPC && b_LimitReached == false)
+        {
+            MRH_ModuleLogger::Singleton().Log("PackageWatch", "Watch limit reached, some packages are not watched!",
+                                              "PackageWatch.cpp", __LINE__);
+            b_LimitReached = true;
+        }
+        
+        return;
+    }
+    
+    m_Watch[i_WD] = s_PackagePath;
+    m_Package[s_PackagePath].emplace_back(i_WD);
+    
+    if (b_Recursive == false)
+    {
+        return;
+    }
+    
+    // Watch the locale directories as well
+    DIR* p_Directory = opendir(s_Directory.c_str());
+    
+    if (p_Directory == NULL)
+    {
+        return;
+    }
+    
+    struct dirent* p_Entry;
+    
+    while ((p_Entry = readdir(p_Directory)) != NULL)
+    {
+        if (p_Entry->d_name[0] == '.')
+        {
+            continue;
+        }
+        else if (p_Entry->d_type == DT_DIR || p_Entry->d_type == DT_UNKNOWN)
+        {
+            // Non-directories are rejected by IN_ONLYDIR
+            AddWatch(s_PackagePath, s_Directory + "/" + p_Entry->d_name, false);
+        }
+    }
+    
+    closedir(p_Directory);
+}
+
+void PackageWatch::RemoveWatches(std::string const& s_PackagePath) noexcept
+{
+    auto Package = m_Package.find(s_PackagePath);
+    
+    if (Package == m_Package.end())
+    {
+        return;
+    }
+    
+    for (auto& WD : Package->second)
+    {
+        inotify_rm_watch(i_FD, WD);
+        m_Watch.erase(WD);
+    }
+    
+    m_Package.erase(Package);
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+PackageWatch::Changes PackageWatch::GetChanges() noexcept
+{
+    Changes c_Changes;
+    c_Changes.b_ListChanged = false;
+    
+    if (i_FD < 0)
+    {
+        return c_Changes;
+    }
+    
+    alignas(struct inotify_event) char p_Buffer[4096];
+    ssize_t ss_Read;
+    
+    while ((ss_Read = read(i_FD, p_Buffer, sizeof(p_Buffer))) > 0)
+    {
+        for (char* p_Pos = p_Buffer; p_Pos < p_Buffer + ss_Read;)
+        {
+            struct inotify_event* p_Event = reinterpret_cast<struct inotify_event*>(p_Pos);
+            p_Pos += sizeof(struct inotify_event) + p_Event->len;
+            
+            if (p_Event->mask & IN_Q_OVERFLOW)
+            {
+                // Events were lost, treat everything as changed
+                c_Changes.b_ListChanged = true;
+                
+                for (auto& Package : m_Package)
+                {
+                    c_Changes.s_Changed.insert(Package.first);
+                }
+                
+                continue;
+            }
+            
+            auto List = m_List.find(p_Event->wd);
+            
+            if (List != m_List.end())
+            {
+                if (p_Event->len > 0 && List->second.count(p_Event->name) > 0)
+                {
+                    c_Changes.b_ListChanged = true;
+                }
+                
+                continue;
+            }
+            
+            auto Watch = m_Watch.find(p_Event->wd);
+            
+            if (Watch != m_Watch.end())
+            {
+                c_Changes.s_Changed.insert(Watch->second);
+            }
+        }
+    }
+    
+    return c_Changes;
+}
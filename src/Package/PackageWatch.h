@@ -0,0 +1,144 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef PackageWatch_h
+#define PackageWatch_h
+
+// C / C++
+#include <string>
+#include <vector>
+#include <list>
+#include <set>
+#include <unordered_map>
+
+// External
+
+// Project
+
+
+class PackageWatch
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Changes
+    {
+    public:
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        bool b_ListChanged;
+        std::set<std::string> s_Changed;
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param v_PackageListPath The full paths to all package list files.
+     */
+    
+    PackageWatch(std::vector<std::string> const& v_PackageListPath) noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~PackageWatch() noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Set the packages to watch. Watches for packages no longer listed or 
+     *  marked as changed are replaced.
+     *
+     *  \param v_PackagePath The full paths of all packages to watch.
+     *  \param s_Changed The full paths of all changed packages.
+     */
+    
+    void SetPackages(std::vector<std::string> const& v_PackagePath,
+                     std::set<std::string> const& s_Changed) noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get all changes since the last call. This function does not block.
+     *
+     *  \return The package changes.
+     */
+    
+    Changes GetChanges() noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Watch
+    //*************************************************************************************
+    
+    /**
+     *  Add a directory watch for a package.
+     *
+     *  \param s_PackagePath The full path to the package.
+     *  \param s_Directory The full path to the directory to watch.
+     *  \param b_Recursive If subdirectories should be watched as well.
+     */
+    
+    void AddWatch(std::string const& s_PackagePath,
+                  std::string const& s_Directory,
+                  bool b_Recursive) noexcept;
+    
+    /**
+     *  Remove all watches for a package.
+     *
+     *  \param s_PackagePath The full path to the package.
+     */
+    
+    void RemoveWatches(std::string const& s_PackagePath) noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    int i_FD;
+    
+    // <Watch Descriptor, List File Names>
+    std::unordered_map<int, std::set<std::string>> m_List;
+    
+    // <Watch Descriptor, Package Path>
+    std::unordered_map<int, std::string> m_Watch;
+    
+    // <Package Path, Watch Descriptors>
+    std::unordered_map<std::string, std::list<int>> m_Package;
+    
+    bool b_LimitReached;
+    
+protected:
+    
+};
+
+#endif /* PackageWatch_h */
@@ -0,0 +1,126 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+
+// External
+
+// Project
+#include "./SelectionCache.h"
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+SelectionCache::SelectionCache(size_t us_Capacity) noexcept : us_Capacity(us_Capacity),
+                                                              u64_Hit(0),
+                                                              u64_Miss(0)
+{}
+
+SelectionCache::~SelectionCache() noexcept
+{}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+void SelectionCache::Set(std::string const& s_Input,
+                         Selection const& v_Selection) noexcept
+{
+    if (us_Capacity == 0)
+    {
+        return;
+    }
+    
+    try
+    {
+        auto Entry = m_Entry.find(s_Input);
+        
+        if (Entry != m_Entry.end())
+        {
+            Entry->second->second = v_Selection;
+            l_Entry.splice(l_Entry.begin(), l_Entry, Entry->second);
+            return;
+        }
+        
+        if (l_Entry.size() >= us_Capacity)
+        {
+            m_Entry.erase(l_Entry.back().first);
+            l_Entry.pop_back();
+        }
+        
+        l_Entry.emplace_front(s_Input, v_Selection);
+        m_Entry.emplace(l_Entry.front().first, l_Entry.begin());
+    }
+    catch (...)
+    {
+        // Not caching is always valid
+        Clear();
+    }
+}
+
+void SelectionCache::Clear() noexcept
+{
+    m_Entry.clear();
+    l_Entry.clear();
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+bool SelectionCache::Get(std::string const& s_Input,
+                         Selection& v_Selection) noexcept
+{
+    auto Entry = m_Entry.find(s_Input);
+    
+    if (Entry == m_Entry.end())
+    {
+        ++u64_Miss;
+        return false;
+    }
+    
+    try
+    {
+        v_Selection = Entry->second->second;
+    }
+    catch (...)
+    {
+        ++u64_Miss;
+        return false;
+    }
+    
+    l_Entry.splice(l_Entry.begin(), l_Entry, Entry->second);
+    ++u64_Hit;
+    
+    return true;
+}
+
+size_t SelectionCache::GetSize() const noexcept
+{
+    return l_Entry.size();
+}
+
+MRH_Uint64 SelectionCache::GetHitCount() const noexcept
+{
+    return u64_Hit;
+}
+
+MRH_Uint64 SelectionCache::GetMissCount() const noexcept
+{
+    return u64_Miss;
+}
@@ -0,0 +1,149 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef SelectionCache_h
+#define SelectionCache_h
+
+// C / C++
+#include <string>
+#include <string_view>
+#include <vector>
+#include <list>
+#include <unordered_map>
+
+// External
+
+// Project
+#include "./TriggerTable.h"
+
+
+class SelectionCache
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    // <Package ID, Evaluation>, in selection order
+    typedef std::vector<std::pair<Package::ID, TriggerTable::Evaluation>> Selection;
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param us_Capacity The maximum amount of cached inputs.
+     */
+    
+    SelectionCache(size_t us_Capacity) noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~SelectionCache() noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Cache the selection for a input. The least recently used input 
+     *  is removed if the cache is full.
+     *
+     *  \param s_Input The input which was evaluated.
+     *  \param v_Selection The selection for the input.
+     */
+    
+    void Set(std::string const& s_Input,
+             Selection const& v_Selection) noexcept;
+    
+    /**
+     *  Remove all cached selections. Hit and miss counts are kept.
+     */
+    
+    void Clear() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the cached selection for a input. A found input becomes the 
+     *  most recently used one.
+     *
+     *  \param s_Input The input to evaluate.
+     *  \param v_Selection The cached selection.
+     *
+     *  \return true if the selection was cached, false if not.
+     */
+    
+    bool Get(std::string const& s_Input,
+             Selection& v_Selection) noexcept;
+    
+    /**
+     *  Get the amount of cached inputs.
+     *
+     *  \return The cached input count.
+     */
+    
+    size_t GetSize() const noexcept;
+    
+    /**
+     *  Get the amount of lookups which found a cached selection.
+     *
+     *  \return The hit count.
+     */
+    
+    MRH_Uint64 GetHitCount() const noexcept;
+    
+    /**
+     *  Get the amount of lookups which found no cached selection.
+     *
+     *  \return The miss count.
+     */
+    
+    MRH_Uint64 GetMissCount() const noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    typedef std::list<std::pair<std::string, Selection>> EntryList;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    size_t us_Capacity;
+    
+    // Most recently used first, keys point into the list
+    EntryList l_Entry;
+    std::unordered_map<std::string_view, EntryList::iterator> m_Entry;
+    
+    MRH_Uint64 u64_Hit;
+    MRH_Uint64 u64_Miss;
+    
+protected:
+    
+};
+
+#endif /* SelectionCache_h */
@@ -0,0 +1,302 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <algorithm>
+#include <unordered_map>
+
+// External
+
+// Project
+#include "./TriggerHash.h"
+
+// Pre-defined
+#ifndef TRIGGER_HASH_BUCKET_SIZE
+    #define TRIGGER_HASH_BUCKET_SIZE 4
+#endif
+#ifndef TRIGGER_HASH_DISPLACE_MAX
+    #define TRIGGER_HASH_DISPLACE_MAX 65536
+#endif
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+TriggerHash::TriggerHash() noexcept
+{}
+
+TriggerHash::TriggerHash(TriggerTable const& c_Table)
+{
+    std::unordered_map<std::string_view, size_t> m_Key;
+    std::vector<Entry> v_Key;
+    std::vector<MRH_Uint32> v_KeyCount; // Triggers with the highest weight
+    std::vector<MRH_Uint32> v_Weight;
+    
+    // Find the highest weight for each key, only packages which match 
+    // equal input are hashed
+    std::vector<bool> v_Hashed(c_Table.GetPackageCount());
+    
+    for (size_t i = 0; i < c_Table.GetPackageCount(); ++i)
+    {
+        v_Hashed[i] = IsHashed(c_Table, i);
+        
+        for (MRH_Uint32 j = c_Table.GetTriggerStart(i); j < c_Table.GetTriggerStart(i + 1); ++j)
+        {
+            MRH_Uint32 u32_Weight = c_Table.GetTriggerWeight(j);
+            v_Weight.emplace_back(u32_Weight);
+            
+            if (v_Hashed[i] == false)
+            {
+                continue;
+            }
+            
+            auto Key = m_Key.emplace(c_Table.GetTriggerKey(j), v_Key.size());
+            
+            if (Key.second == true)
+            {
+                v_Key.push_back({ c_Table.GetTriggerKey(j), u32_Weight, 0, 0, false });
+                v_KeyCount.emplace_back(1);
+            }
+            else if (u32_Weight > v_Key[Key.first->second].u32_Weight)
+            {
+                v_Key[Key.first->second].u32_Weight = u32_Weight;
+                v_KeyCount[Key.first->second] = 1;
+            }
+            else if (u32_Weight == v_Key[Key.first->second].u32_Weight)
+            {
+                ++(v_KeyCount[Key.first->second]);
+            }
+        }
+    }
+    
+    if (v_Key.size() == 0)
+    {
+        return;
+    }
+    
+    // Collect the first trigger of each package with the highest weight, 
+    // as chosen by evaluation
+    std::vector<std::vector<Hit>> v_KeyHit(v_Key.size());
+    
+    for (size_t i = 0; i < c_Table.GetPackageCount(); ++i)
+    {
+        for (MRH_Uint32 j = c_Table.GetTriggerStart(i); j < c_Table.GetTriggerStart(i + 1); ++j)
+        {
+            auto Key = m_Key.find(c_Table.GetTriggerKey(j));
+            
+            if (v_Hashed[i] == false || Key == m_Key.end() ||
+                c_Table.GetTriggerWeight(j) != v_Key[Key->second].u32_Weight)
+            {
+                continue;
+            }
+            
+            std::vector<Hit>& v_Package = v_KeyHit[Key->second];
+            
+            if (v_Package.size() == 0 || v_Package.back().u32_Position != i)
+            {
+                v_Package.push_back({ static_cast<MRH_Uint32>(i), c_Table.GetTriggerValue(j) });
+            }
+        }
+    }
+    
+    std::sort(v_Weight.begin(), v_Weight.end());
+    
+    for (size_t i = 0; i < v_Key.size(); ++i)
+    {
+        size_t us_Higher = v_Weight.end() - std::lower_bound(v_Weight.begin(), v_Weight.end(), v_Key[i].u32_Weight);
+        
+        v_Key[i].u32_HitStart = static_cast<MRH_Uint32>(v_Hit.size());
+        v_Hit.insert(v_Hit.end(), v_KeyHit[i].begin(), v_KeyHit[i].end());
+        v_Key[i].u32_HitEnd = static_cast<MRH_Uint32>(v_Hit.size());
+        v_Key[i].b_Decisive = (us_Higher == v_KeyCount[i]);
+    }
+    
+    // Place keys with hash and displace, largest buckets first. The 
+    // slot count only grows if no displacement is found
+    std::vector<MRH_Uint64> v_Hash(v_Key.size());
+    
+    for (size_t i = 0; i < v_Key.size(); ++i)
+    {
+        v_Hash[i] = Hash(v_Key[i].s_Key);
+    }
+    
+    size_t us_BucketCount = (v_Key.size() / TRIGGER_HASH_BUCKET_SIZE) + 1;
+    std::vector<std::vector<MRH_Uint32>> v_Bucket(us_BucketCount);
+    std::vector<MRH_Uint32> v_Order(us_BucketCount);
+    
+    for (size_t i = 0; i < v_Key.size(); ++i)
+    {
+        v_Bucket[Mix(v_Hash[i], 0) % us_BucketCount].emplace_back(static_cast<MRH_Uint32>(i));
+    }
+    
+    for (size_t i = 0; i < us_BucketCount; ++i)
+    {
+        v_Order[i] = static_cast<MRH_Uint32>(i);
+    }
+    
+    std::stable_sort(v_Order.begin(), v_Order.end(), [&](MRH_Uint32 u32_A, MRH_Uint32 u32_B)
+    {
+        return v_Bucket[u32_A].size() > v_Bucket[u32_B].size();
+    });
+    
+    for (size_t us_SlotCount = v_Key.size();; us_SlotCount += (us_SlotCount / 8) + 1)
+    {
+        std::vector<MRH_Uint32> v_Slot(us_SlotCount, static_cast<MRH_Uint32>(v_Key.size()));
+        std::vector<size_t> v_Try;
+        bool b_Placed = true;
+        
+        v_Displace.assign(us_BucketCount, 0);
+        
+        for (auto& Bucket : v_Order)
+        {
+            std::vector<MRH_Uint32> const& v_Member = v_Bucket[Bucket];
+            MRH_Uint32 u32_Seed = 1;
+            
+            for (; u32_Seed <= TRIGGER_HASH_DISPLACE_MAX; ++u32_Seed)
+            {
+                v_Try.clear();
+                
+                for (auto& Member : v_Member)
+                {
+                    size_t us_Slot = Mix(v_Hash[Member], u32_Seed) % us_SlotCount;
+                    
+                    if (v_Slot[us_Slot] != v_Key.size() || std::find(v_Try.begin(), v_Try.end(), us_Slot) != v_Try.end())
+                    {
+                        break;
+                    }
+                    
+                    v_Try.emplace_back(us_Slot);
+                }
+                
+                if (v_Try.size() == v_Member.size())
+                {
+                    break;
+                }
+            }
+            
+            if (u32_Seed > TRIGGER_HASH_DISPLACE_MAX)
+            {
+                b_Placed = false;
+                break;
+            }
+            
+            v_Displace[Bucket] = u32_Seed;
+            
+            for (size_t i = 0; i < v_Member.size(); ++i)
+            {
+                v_Slot[v_Try[i]] = v_Member[i];
+            }
+        }
+        
+        if (b_Placed == true)
+        {
+            // Unused slots have no hits
+            v_Entry.assign(us_SlotCount, { std::string_view(), 0, 0, 0, false });
+            
+            for (size_t i = 0; i < us_SlotCount; ++i)
+            {
+                if (v_Slot[i] != v_Key.size())
+                {
+                    v_Entry[i] = v_Key[v_Slot[i]];
+                }
+            }
+            
+            return;
+        }
+    }
+}
+
+TriggerHash::~TriggerHash() noexcept
+{}
+
+//*************************************************************************************
+// Hash
+//*************************************************************************************
+
+bool TriggerHash::IsHashed(TriggerTable const& c_Table,
+                           size_t us_Position) noexcept
+{
+    // Similarity above 1 never matches
+    if (c_Table.GetCompareMethod(us_Position) == LaunchTrigger::LEVENSHTEIN && c_Table.GetSimilarity(us_Position) > 1.f)
+    {
+        return false;
+    }
+    
+    // A matching trigger with a negative value invalidates the package 
+    // evaluation, a equal trigger would not guarantee a result
+    for (MRH_Uint32 i = c_Table.GetTriggerStart(us_Position); i < c_Table.GetTriggerStart(us_Position + 1); ++i)
+    {
+        if (c_Table.GetTriggerValue(i) < 0)
+        {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+MRH_Uint64 TriggerHash::Hash(std::string_view s_Key) noexcept
+{
+    // FNV-1a
+    MRH_Uint64 u64_Hash = 14695981039346656037ULL;
+    
+    for (auto& Char : s_Key)
+    {
+        u64_Hash ^= static_cast<MRH_Uint8>(Char);
+        u64_Hash *= 1099511628211ULL;
+    }
+    
+    return u64_Hash;
+}
+
+MRH_Uint64 TriggerHash::Mix(MRH_Uint64 u64_Hash, MRH_Uint64 u64_Seed) noexcept
+{
+    // SplitMix64 finalizer
+    MRH_Uint64 u64_Mix = u64_Hash + (u64_Seed * 0x9E3779B97F4A7C15ULL);
+    
+    u64_Mix = (u64_Mix ^ (u64_Mix >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    u64_Mix = (u64_Mix ^ (u64_Mix >> 27)) * 0x94D049BB133111EBULL;
+    
+    return u64_Mix ^ (u64_Mix >> 31);
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+TriggerHash::Entry const* TriggerHash::Find(std::string_view s_Input) const noexcept
+{
+    if (v_Entry.size() == 0)
+    {
+        return NULL;
+    }
+    
+    MRH_Uint64 u64_Hash = Hash(s_Input);
+    Entry const& c_Entry = v_Entry[Mix(u64_Hash, v_Displace[Mix(u64_Hash, 0) % v_Displace.size()]) % v_Entry.size()];
+    
+    if (c_Entry.u32_HitStart == c_Entry.u32_HitEnd || c_Entry.s_Key.compare(s_Input) != 0)
+    {
+        return NULL;
+    }
+    
+    return &c_Entry;
+}
+
+TriggerHash::Hit const& TriggerHash::GetHit(MRH_Uint32 u32_Hit) const noexcept
+{
+    return v_Hit[u32_Hit];
+}
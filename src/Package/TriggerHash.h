@@ -0,0 +1,173 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef TriggerHash_h
+#define TriggerHash_h
+
+// C / C++
+#include <vector>
+#include <string_view>
+
+// External
+
+// Project
+#include "./TriggerTable.h"
+
+
+class TriggerHash
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Hit
+    {
+    public:
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        MRH_Uint32 u32_Position; // Package position in the trigger table
+        MRH_Sint32 s32_Value;
+    };
+    
+    struct Entry
+    {
+    public:
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        std::string_view s_Key;
+        MRH_Uint32 u32_Weight; // Highest weight of all triggers with the key
+        
+        // Packages with a trigger of the highest weight, in table order
+        MRH_Uint32 u32_HitStart;
+        MRH_Uint32 u32_HitEnd;
+        
+        // No trigger without the key has the same or a higher weight, 
+        // the hits are the full evaluation result
+        bool b_Decisive;
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor. The hash is empty.
+     */
+    
+    TriggerHash() noexcept;
+    
+    /**
+     *  Table constructor.
+     *
+     *  \param c_Table The trigger table to hash. The table has to outlive 
+     *                 the hash and must not change.
+     */
+    
+    TriggerHash(TriggerTable const& c_Table);
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~TriggerHash() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Find the triggers which are equal to a input.
+     *
+     *  \param s_Input The normalised input to find.
+     *
+     *  \return The entry for the input or NULL if no trigger is equal.
+     */
+    
+    Entry const* Find(std::string_view s_Input) const noexcept;
+    
+    /**
+     *  Get a package hit of a entry.
+     *
+     *  \param u32_Hit The hit, in the range of the entry.
+     *
+     *  \return The package hit.
+     */
+    
+    Hit const& GetHit(MRH_Uint32 u32_Hit) const noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Hash
+    //*************************************************************************************
+    
+    /**
+     *  Check if the triggers of a package can be hashed. Equal triggers 
+     *  of hashed packages always produce a valid evaluation.
+     *
+     *  \param c_Table The trigger table.
+     *  \param us_Position The package position in the table.
+     *
+     *  \return true if the package can be hashed, false if not.
+     */
+    
+    static bool IsHashed(TriggerTable const& c_Table,
+                         size_t us_Position) noexcept;
+    
+    /**
+     *  Hash a key.
+     *
+     *  \param s_Key The key to hash.
+     *
+     *  \return The key hash.
+     */
+    
+    static MRH_Uint64 Hash(std::string_view s_Key) noexcept;
+    
+    /**
+     *  Derive a seeded hash from a key hash.
+     *
+     *  \param u64_Hash The key hash.
+     *  \param u64_Seed The seed to use.
+     *
+     *  \return The seeded hash.
+     */
+    
+    static MRH_Uint64 Mix(MRH_Uint64 u64_Hash, MRH_Uint64 u64_Seed) noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    // Hash and displace, each bucket stores the seed placing its keys
+    std::vector<MRH_Uint32> v_Displace;
+    std::vector<Entry> v_Entry; // Indexed by slot
+    
+    std::vector<Hit> v_Hit;
+    
+protected:
+    
+};
+
+#endif /* TriggerHash_h */
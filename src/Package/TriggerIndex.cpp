@@ -0,0 +1,239 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <algorithm>
+#include <limits>
+
+// External
+
+// Project
+#include "./TriggerIndex.h"
+#include "../Compare/Levenshtein.h"
+
+// Pre-defined
+#ifndef TRIGGER_INDEX_GRAM_SIZE
+    #define TRIGGER_INDEX_GRAM_SIZE 2
+#endif
+
+static_assert(TRIGGER_INDEX_GRAM_SIZE > 0 && TRIGGER_INDEX_GRAM_SIZE <= 4, "Grams have to fit into 32 bit!");
+
+namespace
+{
+    constexpr size_t us_Q = TRIGGER_INDEX_GRAM_SIZE;
+    
+    // Strings within the edit distance share at least this many 
+    // grams (q-gram lemma), a result <= 0 can't reject anything
+    long long GetMinCommon(size_t us_Length, size_t us_Distance) noexcept
+    {
+        return static_cast<long long>(us_Length) - static_cast<long long>(us_Q) + 1 - static_cast<long long>(us_Distance * us_Q);
+    }
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+TriggerIndex::TriggerIndex() noexcept
+{}
+
+TriggerIndex::TriggerIndex(TriggerTable const& c_Table)
+{
+    MRH_Uint32 u32_TriggerCount = c_Table.GetTriggerStart(c_Table.GetPackageCount());
+    std::vector<MRH_Uint32> v_Gram;
+    
+    v_Position.resize(u32_TriggerCount);
+    v_Length.resize(u32_TriggerCount);
+    v_Similarity.resize(u32_TriggerCount);
+    v_Common.resize(u32_TriggerCount, 0);
+    
+    for (size_t i = 0; i < c_Table.GetPackageCount(); ++i)
+    {
+        LaunchTrigger::CompareMethod e_Method = c_Table.GetCompareMethod(i);
+        float f32_Similarity = c_Table.GetSimilarity(i);
+        
+        for (MRH_Uint32 j = c_Table.GetTriggerStart(i); j < c_Table.GetTriggerStart(i + 1); ++j)
+        {
+            std::string_view s_String = c_Table.GetTriggerKey(j);
+            
+            v_Position[j] = static_cast<MRH_Uint32>(i);
+            v_Length[j] = static_cast<MRH_Uint32>(s_String.size());
+            v_Similarity[j] = f32_Similarity;
+            
+            if (e_Method != LaunchTrigger::LEVENSHTEIN)
+            {
+                m_Exact.emplace(s_String, j);
+                continue;
+            }
+            
+            // Find the longest input length for which the count filter 
+            // fails, the gram count grows faster than the distance 
+            // if q * (1 - similarity) < 1
+            float f32_Growth = 1.f - (static_cast<float>(us_Q) * (1.f - f32_Similarity));
+            size_t us_Unfiltered = 0;
+            
+            if (f32_Growth <= 0.f)
+            {
+                us_Unfiltered = std::numeric_limits<size_t>::max();
+            }
+            else
+            {
+                size_t us_Max = static_cast<size_t>((2.f * us_Q) / f32_Growth) + 2;
+                
+                for (size_t L = s_String.size(); L <= us_Max; ++L)
+                {
+                    if (GetMinCommon(L, Levenshtein::MaxDistance(L, f32_Similarity)) <= 0)
+                    {
+                        us_Unfiltered = L;
+                    }
+                }
+            }
+            
+            if (us_Unfiltered > 0)
+            {
+                v_Unfiltered.emplace_back(j, us_Unfiltered);
+            }
+            
+            // Add postings, grams are sorted
+            GetGrams(s_String, v_Gram);
+            
+            for (size_t k = 0; k < v_Gram.size();)
+            {
+                size_t l = k + 1;
+                
+                while (l < v_Gram.size() && v_Gram[l] == v_Gram[k])
+                {
+                    ++l;
+                }
+                
+                m_Gram[v_Gram[k]].push_back({ j, static_cast<MRH_Uint32>(l - k) });
+                k = l;
+            }
+        }
+    }
+}
+
+TriggerIndex::~TriggerIndex() noexcept
+{}
+
+//*************************************************************************************
+// Grams
+//*************************************************************************************
+
+void TriggerIndex::GetGrams(std::string_view s_String,
+                            std::vector<MRH_Uint32>& v_Gram)
+{
+    v_Gram.clear();
+    
+    if (s_String.size() < us_Q)
+    {
+        return;
+    }
+    
+    for (size_t i = 0; i + us_Q <= s_String.size(); ++i)
+    {
+        MRH_Uint32 u32_Gram = 0;
+        
+        for (size_t j = 0; j < us_Q; ++j)
+        {
+            u32_Gram = (u32_Gram << 8) | static_cast<MRH_Uint8>(s_String[i + j]);
+        }
+        
+        v_Gram.emplace_back(u32_Gram);
+    }
+    
+    std::sort(v_Gram.begin(), v_Gram.end());
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+void TriggerIndex::GetCandidates(std::string_view s_Input,
+                                 std::vector<size_t>& v_Result) const
+{
+    v_Result.clear();
+    
+    // Count common grams for all fuzzy triggers sharing a gram
+    GetGrams(s_Input, v_InputGram);
+    
+    for (size_t i = 0; i < v_InputGram.size();)
+    {
+        size_t j = i + 1;
+        
+        while (j < v_InputGram.size() && v_InputGram[j] == v_InputGram[i])
+        {
+            ++j;
+        }
+        
+        auto Gram = m_Gram.find(v_InputGram[i]);
+        MRH_Uint32 u32_Count = static_cast<MRH_Uint32>(j - i);
+        
+        if (Gram != m_Gram.end())
+        {
+            for (auto& Posting : Gram->second)
+            {
+                if (v_Common[Posting.u32_Trigger] == 0)
+                {
+                    v_Touched.emplace_back(Posting.u32_Trigger);
+                }
+                
+                v_Common[Posting.u32_Trigger] += std::min(u32_Count, Posting.u32_Count);
+            }
+        }
+        
+        i = j;
+    }
+    
+    // Apply length and count filter
+    size_t us_Input = s_Input.size();
+    
+    for (auto& Trigger : v_Touched)
+    {
+        size_t us_Length = std::max(static_cast<size_t>(v_Length[Trigger]), us_Input);
+        size_t us_Distance = Levenshtein::MaxDistance(us_Length, v_Similarity[Trigger]);
+        size_t us_Difference = (v_Length[Trigger] > us_Input ? v_Length[Trigger] - us_Input : us_Input - v_Length[Trigger]);
+        
+        if (us_Difference <= us_Distance && static_cast<long long>(v_Common[Trigger]) >= GetMinCommon(us_Length, us_Distance))
+        {
+            v_Result.emplace_back(v_Position[Trigger]);
+        }
+        
+        v_Common[Trigger] = 0;
+    }
+    
+    v_Touched.clear();
+    
+    // Short inputs can't be rejected by gram count
+    for (auto& Unfiltered : v_Unfiltered)
+    {
+        if (us_Input <= Unfiltered.second)
+        {
+            v_Result.emplace_back(v_Position[Unfiltered.first]);
+        }
+    }
+    
+    auto Exact = m_Exact.equal_range(s_Input);
+    
+    for (auto It = Exact.first; It != Exact.second; ++It)
+    {
+        v_Result.emplace_back(v_Position[It->second]);
+    }
+    
+    std::sort(v_Result.begin(), v_Result.end());
+    v_Result.erase(std::unique(v_Result.begin(), v_Result.end()), v_Result.end());
+}
@@ -0,0 +1,138 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef TriggerIndex_h
+#define TriggerIndex_h
+
+// C / C++
+#include <vector>
+#include <unordered_map>
+#include <string_view>
+
+// External
+
+// Project
+#include "./TriggerTable.h"
+
+
+class TriggerIndex
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor. The index is empty.
+     */
+    
+    TriggerIndex() noexcept;
+    
+    /**
+     *  Table constructor.
+     *
+     *  \param c_Table The trigger table to index. The table has to outlive 
+     *                 the index and must not change.
+     */
+    
+    TriggerIndex(TriggerTable const& c_Table);
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~TriggerIndex() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the packages which might match a input. Packages which are not 
+     *  returned are guaranteed to not match. This function is not thread 
+     *  safe.
+     *
+     *  \param s_Input The normalised input to match.
+     *  \param v_Position The package positions in the trigger table, in 
+     *                    ascending order.
+     */
+    
+    void GetCandidates(std::string_view s_Input,
+                       std::vector<size_t>& v_Position) const;
+    
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Posting
+    {
+    public:
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        MRH_Uint32 u32_Trigger;
+        MRH_Uint32 u32_Count;
+    };
+    
+    //*************************************************************************************
+    // Grams
+    //*************************************************************************************
+    
+    /**
+     *  Get the sorted q-grams of a string. Equal grams are listed 
+     *  multiple times.
+     *
+     *  \param s_String The string to split.
+     *  \param v_Gram The grams of the string.
+     */
+    
+    static void GetGrams(std::string_view s_String,
+                         std::vector<MRH_Uint32>& v_Gram);
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    // Per trigger
+    std::vector<MRH_Uint32> v_Position;
+    std::vector<MRH_Uint32> v_Length;
+    std::vector<float> v_Similarity;
+    
+    // <Gram, Fuzzy triggers containing the gram>
+    std::unordered_map<MRH_Uint32, std::vector<Posting>> m_Gram;
+    
+    // Fuzzy triggers the count filter can't reject, with the longest 
+    // input length for which the filter fails
+    std::vector<std::pair<MRH_Uint32, size_t>> v_Unfiltered;
+    
+    // <Trigger Key, Exact triggers>
+    std::unordered_multimap<std::string_view, MRH_Uint32> m_Exact;
+    
+    // Query buffers, sized by trigger count
+    mutable std::vector<MRH_Uint32> v_Common;
+    mutable std::vector<MRH_Uint32> v_Touched;
+    mutable std::vector<MRH_Uint32> v_InputGram;
+    
+protected:
+    
+};
+
+#endif /* TriggerIndex_h */
@@ -0,0 +1,107 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+// C / C++
+#include <algorithm>
+
+// External
+
+// Project
+#include "./TriggerRanking.h"
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+TriggerRanking::TriggerRanking(size_t us_Size) : us_Size(us_Size)
+{
+    v_Heap.reserve(us_Size);
+}
+
+TriggerRanking::~TriggerRanking() noexcept
+{}
+
+TriggerRanking::Candidate::Candidate(size_t us_Position,
+                                     Package::ID u32_PackageID,
+                                     TriggerTable::Evaluation const& c_Evaluation) noexcept : us_Position(us_Position),
+                                                                                               u32_PackageID(u32_PackageID),
+                                                                                               c_Evaluation(c_Evaluation)
+{}
+
+//*************************************************************************************
+// Add
+//*************************************************************************************
+
+void TriggerRanking::Add(Candidate const& c_Candidate) noexcept
+{
+    if (c_Candidate.c_Evaluation.s32_Value < 0 || us_Size == 0)
+    {
+        return;
+    }
+    
+    // Capacity was reserved, adding never allocates
+    if (v_Heap.size() < us_Size)
+    {
+        v_Heap.emplace_back(c_Candidate);
+        std::push_heap(v_Heap.begin(), v_Heap.end(), GetHigher);
+    }
+    else if (GetHigher(c_Candidate, v_Heap.front()) == true)
+    {
+        std::pop_heap(v_Heap.begin(), v_Heap.end(), GetHigher);
+        v_Heap.back() = c_Candidate;
+        std::push_heap(v_Heap.begin(), v_Heap.end(), GetHigher);
+    }
+}
+
+void TriggerRanking::Add(TriggerRanking const& c_Ranking) noexcept
+{
+    for (auto& Candidate : c_Ranking.v_Heap)
+    {
+        Add(Candidate);
+    }
+}
+
+//*************************************************************************************
+// Rank
+//*************************************************************************************
+
+bool TriggerRanking::GetHigher(Candidate const& c_A,
+                               Candidate const& c_B) noexcept
+{
+    if (c_A.c_Evaluation.u32_Weight != c_B.c_Evaluation.u32_Weight)
+    {
+        return c_A.c_Evaluation.u32_Weight > c_B.c_Evaluation.u32_Weight;
+    }
+    else if (c_A.c_Evaluation.f32_Similarity != c_B.c_Evaluation.f32_Similarity)
+    {
+        return c_A.c_Evaluation.f32_Similarity > c_B.c_Evaluation.f32_Similarity;
+    }
+    
+    // Earlier packages win, as in the package list
+    return c_A.us_Position < c_B.us_Position;
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+void TriggerRanking::GetCandidates(std::vector<Candidate>& v_Candidate) const
+{
+    v_Candidate = v_Heap;
+    std::sort(v_Candidate.begin(), v_Candidate.end(), GetHigher);
+}
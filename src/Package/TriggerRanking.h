@@ -0,0 +1,151 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#ifndef TriggerRanking_h
+#define TriggerRanking_h
+
+// C / C++
+#include <vector>
+
+// External
+
+// Project
+#include "./TriggerTable.h"
+
+
+class TriggerRanking
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Candidate
+    {
+    public:
+        
+        //*************************************************************************************
+        // Constructor
+        //*************************************************************************************
+        
+        /**
+         *  Default constructor.
+         *
+         *  \param us_Position The package position in the trigger table.
+         *  \param u32_PackageID The id of the package.
+         *  \param c_Evaluation The package evaluation.
+         */
+        
+        Candidate(size_t us_Position,
+                  Package::ID u32_PackageID,
+                  TriggerTable::Evaluation const& c_Evaluation) noexcept;
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        size_t us_Position;
+        Package::ID u32_PackageID;
+        TriggerTable::Evaluation c_Evaluation;
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param us_Size The maximum amount of ranked candidates.
+     */
+    
+    TriggerRanking(size_t us_Size);
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~TriggerRanking() noexcept;
+    
+    //*************************************************************************************
+    // Add
+    //*************************************************************************************
+    
+    /**
+     *  Add a candidate. Candidates are ranked by weight, then similarity, 
+     *  then table position. The lowest ranked candidate is dropped if the 
+     *  ranking is full. Candidates without a matching trigger are ignored.
+     *
+     *  \param c_Candidate The candidate to add.
+     */
+    
+    void Add(Candidate const& c_Candidate) noexcept;
+    
+    /**
+     *  Add all candidates of another ranking.
+     *
+     *  \param c_Ranking The ranking to add.
+     */
+    
+    void Add(TriggerRanking const& c_Ranking) noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the ranked candidates.
+     *
+     *  \param v_Candidate The candidates, highest rank first.
+     */
+    
+    void GetCandidates(std::vector<Candidate>& v_Candidate) const;
+    
+private:
+    
+    //*************************************************************************************
+    // Rank
+    //*************************************************************************************
+    
+    /**
+     *  Check if a candidate ranks higher than another.
+     *
+     *  \param c_A The first candidate.
+     *  \param c_B The second candidate.
+     *
+     *  \return true if the first candidate ranks higher, false if not.
+     */
+    
+    static bool GetHigher(Candidate const& c_A,
+                          Candidate const& c_B) noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    size_t us_Size;
+    
+    // Heap with the lowest ranked candidate first, never grows beyond 
+    // the reserved size
+    std::vector<Candidate> v_Heap;
+    
+protected:
+    
+};
+
+#endif /* TriggerRanking_h */
@@ -0,0 +1,202 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+
+// External
+
+// Project
+#include "./TriggerTable.h"
+#include "../Compare/Levenshtein.h"
+#include "../Compare/Normalise.h"
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+TriggerTable::TriggerTable() noexcept : v_TriggerStart(1, 0)
+{}
+
+TriggerTable::~TriggerTable() noexcept
+{}
+
+TriggerTable::Evaluation::Evaluation(MRH_Sint32 s32_Value,
+                                     MRH_Uint32 u32_Weight,
+                                     float f32_Similarity) noexcept : s32_Value(s32_Value),
+                                                                      u32_Weight(u32_Weight),
+                                                                      f32_Similarity(f32_Similarity)
+{}
+
+//*************************************************************************************
+// Add
+//*************************************************************************************
+
+void TriggerTable::Add(Package::ID u32_PackageID,
+                       LaunchTrigger const& c_LaunchTrigger,
+                       StringPool& c_StringPool)
+{
+    v_PackageID.emplace_back(u32_PackageID);
+    v_CompareMethod.emplace_back(static_cast<MRH_Uint8>(c_LaunchTrigger.GetCompareMethod()));
+    v_Similarity.emplace_back(c_LaunchTrigger.GetSimilarity());
+    
+    for (auto& Trigger : c_LaunchTrigger.GetTriggers())
+    {
+        v_Weight.emplace_back(Trigger.u32_Weight);
+        v_Value.emplace_back(Trigger.s32_Value);
+        v_String.emplace_back(c_StringPool.Add(Trigger.s_String));
+        v_Key.emplace_back(c_StringPool.Add(Normalise::String(Trigger.s_String)));
+    }
+    
+    v_TriggerStart.emplace_back(static_cast<MRH_Uint32>(v_String.size()));
+}
+
+void TriggerTable::Add(TriggerTable const& c_Table,
+                       size_t us_Position)
+{
+    v_PackageID.emplace_back(c_Table.v_PackageID[us_Position]);
+    v_CompareMethod.emplace_back(c_Table.v_CompareMethod[us_Position]);
+    v_Similarity.emplace_back(c_Table.v_Similarity[us_Position]);
+    
+    MRH_Uint32 u32_Start = c_Table.v_TriggerStart[us_Position];
+    MRH_Uint32 u32_End = c_Table.v_TriggerStart[us_Position + 1];
+    
+    v_Weight.insert(v_Weight.end(), c_Table.v_Weight.begin() + u32_Start, c_Table.v_Weight.begin() + u32_End);
+    v_Value.insert(v_Value.end(), c_Table.v_Value.begin() + u32_Start, c_Table.v_Value.begin() + u32_End);
+    v_String.insert(v_String.end(), c_Table.v_String.begin() + u32_Start, c_Table.v_String.begin() + u32_End);
+    v_Key.insert(v_Key.end(), c_Table.v_Key.begin() + u32_Start, c_Table.v_Key.begin() + u32_End);
+    
+    v_TriggerStart.emplace_back(static_cast<MRH_Uint32>(v_String.size()));
+}
+
+void TriggerTable::Add(TriggerTable const& c_Table,
+                       size_t us_Position,
+                       StringPool& c_StringPool)
+{
+    v_PackageID.emplace_back(c_Table.v_PackageID[us_Position]);
+    v_CompareMethod.emplace_back(c_Table.v_CompareMethod[us_Position]);
+    v_Similarity.emplace_back(c_Table.v_Similarity[us_Position]);
+    
+    for (MRH_Uint32 i = c_Table.v_TriggerStart[us_Position]; i < c_Table.v_TriggerStart[us_Position + 1]; ++i)
+    {
+        v_Weight.emplace_back(c_Table.v_Weight[i]);
+        v_Value.emplace_back(c_Table.v_Value[i]);
+        v_String.emplace_back(c_StringPool.Add(c_Table.v_String[i]));
+        v_Key.emplace_back(c_StringPool.Add(c_Table.v_Key[i]));
+    }
+    
+    v_TriggerStart.emplace_back(static_cast<MRH_Uint32>(v_String.size()));
+}
+
+//*************************************************************************************
+// Evaluate
+//*************************************************************************************
+
+TriggerTable::Evaluation TriggerTable::Evaluate(size_t us_Position,
+                                                std::string_view s_Input,
+                                                MRH_Uint32 u32_MinWeight) const noexcept
+{
+    Evaluation c_Result(-1, 0, 0.f);
+    MRH_Uint32 u32_End = v_TriggerStart[us_Position + 1];
+    float f32_Similarity;
+    bool b_Match;
+    
+    for (MRH_Uint32 i = v_TriggerStart[us_Position]; i < u32_End; ++i)
+    {
+        // Lower or equal weight can't replace the current result
+        if (v_Weight[i] < u32_MinWeight || (c_Result.s32_Value >= 0 && v_Weight[i] <= c_Result.u32_Weight))
+        {
+            continue;
+        }
+        
+        switch (v_CompareMethod[us_Position])
+        {
+            case LaunchTrigger::LEVENSHTEIN:
+                b_Match = Levenshtein::Match(v_Key[i], s_Input, v_Similarity[us_Position], f32_Similarity);
+                break;
+                
+            default:
+                b_Match = v_Key[i].compare(s_Input) == 0;
+                f32_Similarity = 1.f;
+                break;
+        }
+        
+        if (b_Match == true)
+        {
+            c_Result = Evaluation(v_Value[i], v_Weight[i], f32_Similarity);
+        }
+    }
+    
+    return c_Result;
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+size_t TriggerTable::GetPackageCount() const noexcept
+{
+    return v_PackageID.size();
+}
+
+Package::ID TriggerTable::GetPackageID(size_t us_Position) const noexcept
+{
+    return v_PackageID[us_Position];
+}
+
+LaunchTrigger::CompareMethod TriggerTable::GetCompareMethod(size_t us_Position) const noexcept
+{
+    return static_cast<LaunchTrigger::CompareMethod>(v_CompareMethod[us_Position]);
+}
+
+float TriggerTable::GetSimilarity(size_t us_Position) const noexcept
+{
+    return v_Similarity[us_Position];
+}
+
+MRH_Uint32 TriggerTable::GetTriggerStart(size_t us_Position) const noexcept
+{
+    return v_TriggerStart[us_Position];
+}
+
+std::string_view TriggerTable::GetTriggerKey(MRH_Uint32 u32_Trigger) const noexcept
+{
+    return v_Key[u32_Trigger];
+}
+
+MRH_Uint32 TriggerTable::GetTriggerWeight(MRH_Uint32 u32_Trigger) const noexcept
+{
+    return v_Weight[u32_Trigger];
+}
+
+MRH_Sint32 TriggerTable::GetTriggerValue(MRH_Uint32 u32_Trigger) const noexcept
+{
+    return v_Value[u32_Trigger];
+}
+
+LaunchTrigger TriggerTable::GetLaunchTrigger(size_t us_Position) const
+{
+    std::vector<LaunchTrigger::Trigger> v_Trigger;
+    
+    for (MRH_Uint32 i = v_TriggerStart[us_Position]; i < v_TriggerStart[us_Position + 1]; ++i)
+    {
+        v_Trigger.push_back({ std::string(v_String[i]), v_Weight[i], v_Value[i] });
+    }
+    
+    return LaunchTrigger(static_cast<LaunchTrigger::CompareMethod>(v_CompareMethod[us_Position]),
+                         v_Similarity[us_Position],
+                         std::move(v_Trigger));
+}
@@ -0,0 +1,262 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef TriggerTable_h
+#define TriggerTable_h
+
+// C / C++
+#include <vector>
+#include <utility>
+
+// External
+
+// Project
+#include "./Package.h"
+
+
+class TriggerTable
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Evaluation
+    {
+    public:
+        
+        //*************************************************************************************
+        // Constructor
+        //*************************************************************************************
+        
+        /**
+         *  Default constructor.
+         *
+         *  \param s32_Value The value of the matching trigger.
+         *  \param u32_Weight The weight of the matching trigger.
+         *  \param f32_Similarity The similarity of the matching trigger and the input.
+         */
+        
+        Evaluation(MRH_Sint32 s32_Value,
+                   MRH_Uint32 u32_Weight,
+                   float f32_Similarity) noexcept;
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        MRH_Sint32 s32_Value; // Negative if no trigger matched
+        MRH_Uint32 u32_Weight;
+        float f32_Similarity; // 1.0 for equal strings
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    TriggerTable() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~TriggerTable() noexcept;
+    
+    //*************************************************************************************
+    // Add
+    //*************************************************************************************
+    
+    /**
+     *  Add a package at the end of the table. The normalised trigger 
+     *  strings are stored as comparison keys.
+     *
+     *  \param u32_PackageID The id of the package to add.
+     *  \param c_LaunchTrigger The launch trigger of the package.
+     *  \param c_StringPool The pool to store the trigger strings in. The pool 
+     *                      has to outlive the table.
+     */
+    
+    void Add(Package::ID u32_PackageID,
+             LaunchTrigger const& c_LaunchTrigger,
+             StringPool& c_StringPool);
+    
+    /**
+     *  Add a package from another table at the end of the table.
+     *
+     *  \param c_Table The table to copy from.
+     *  \param us_Position The package position in the table to copy from.
+     */
+    
+    void Add(TriggerTable const& c_Table,
+             size_t us_Position);
+    
+    /**
+     *  Add a package from another table at the end of the table. The 
+     *  trigger strings are stored in another pool.
+     *
+     *  \param c_Table The table to copy from.
+     *  \param us_Position The package position in the table to copy from.
+     *  \param c_StringPool The pool to store the trigger strings in. The pool 
+     *                      has to outlive the table.
+     */
+    
+    void Add(TriggerTable const& c_Table,
+             size_t us_Position,
+             StringPool& c_StringPool);
+    
+    //*************************************************************************************
+    // Evaluate
+    //*************************************************************************************
+    
+    /**
+     *  Evaluate a input string for a package. The matching trigger with the 
+     *  highest weight is chosen, the first trigger wins on equal weight.
+     *
+     *  \param us_Position The package position in the table.
+     *  \param s_Input The normalised input to evaluate.
+     *  \param u32_MinWeight The lowest trigger weight to evaluate. Triggers 
+     *                       with a lower weight are skipped.
+     *
+     *  \return The evaluation result. The value is negative if no trigger matched.
+     */
+    
+    Evaluation Evaluate(size_t us_Position,
+                        std::string_view s_Input,
+                        MRH_Uint32 u32_MinWeight) const noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the amount of packages in the table.
+     *
+     *  \return The package count.
+     */
+    
+    size_t GetPackageCount() const noexcept;
+    
+    /**
+     *  Get the id of a package.
+     *
+     *  \param us_Position The package position in the table.
+     *
+     *  \return The package id.
+     */
+    
+    Package::ID GetPackageID(size_t us_Position) const noexcept;
+    
+    /**
+     *  Get the compare method of a package.
+     *
+     *  \param us_Position The package position in the table.
+     *
+     *  \return The package compare method.
+     */
+    
+    LaunchTrigger::CompareMethod GetCompareMethod(size_t us_Position) const noexcept;
+    
+    /**
+     *  Get the required similarity of a package.
+     *
+     *  \param us_Position The package position in the table.
+     *
+     *  \return The package similarity.
+     */
+    
+    float GetSimilarity(size_t us_Position) const noexcept;
+    
+    /**
+     *  Get the first trigger of a package. The triggers of a package end 
+     *  at the first trigger of the next package, the package count gives 
+     *  the total trigger count.
+     *
+     *  \param us_Position The package position in the table, up to and 
+     *                     including the package count.
+     *
+     *  \return The first trigger.
+     */
+    
+    MRH_Uint32 GetTriggerStart(size_t us_Position) const noexcept;
+    
+    /**
+     *  Get the comparison key of a trigger.
+     *
+     *  \param u32_Trigger The trigger in the table.
+     *
+     *  \return The normalised trigger string.
+     */
+    
+    std::string_view GetTriggerKey(MRH_Uint32 u32_Trigger) const noexcept;
+    
+    /**
+     *  Get the weight of a trigger.
+     *
+     *  \param u32_Trigger The trigger in the table.
+     *
+     *  \return The trigger weight.
+     */
+    
+    MRH_Uint32 GetTriggerWeight(MRH_Uint32 u32_Trigger) const noexcept;
+    
+    /**
+     *  Get the value of a trigger.
+     *
+     *  \param u32_Trigger The trigger in the table.
+     *
+     *  \return The trigger value.
+     */
+    
+    MRH_Sint32 GetTriggerValue(MRH_Uint32 u32_Trigger) const noexcept;
+    
+    /**
+     *  Rebuild the launch trigger of a package.
+     *
+     *  \param us_Position The package position in the table.
+     *
+     *  \return The package launch trigger.
+     */
+    
+    LaunchTrigger GetLaunchTrigger(size_t us_Position) const;
+    
+private:
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    // Per package, in package list order
+    std::vector<Package::ID> v_PackageID;
+    std::vector<MRH_Uint8> v_CompareMethod;
+    std::vector<float> v_Similarity;
+    std::vector<MRH_Uint32> v_TriggerStart; // Package count + 1 entries
+    
+    // Per trigger, grouped by package
+    std::vector<MRH_Uint32> v_Weight;
+    std::vector<MRH_Sint32> v_Value;
+    std::vector<std::string_view> v_String; // Pooled
+    std::vector<std::string_view> v_Key; // Pooled, normalised string
+    
+protected:
+    
+};
+
+#endif /* TriggerTable_h */
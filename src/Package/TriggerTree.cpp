@@ -0,0 +1,199 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <algorithm>
+
+// External
+
+// Project
+#include "./TriggerTree.h"
+#include "../Compare/Levenshtein.h"
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+TriggerTree::TriggerTree() noexcept
+{}
+
+TriggerTree::TriggerTree(TriggerTable const& c_Table)
+{
+    // Group fuzzy triggers by key, each key is one node
+    std::unordered_map<std::string_view, MRH_Uint32> m_Key;
+    std::vector<std::vector<std::pair<MRH_Uint32, float>>> v_KeyTrigger;
+    
+    for (size_t i = 0; i < c_Table.GetPackageCount(); ++i)
+    {
+        LaunchTrigger::CompareMethod e_Method = c_Table.GetCompareMethod(i);
+        float f32_Similarity = c_Table.GetSimilarity(i);
+        
+        for (MRH_Uint32 j = c_Table.GetTriggerStart(i); j < c_Table.GetTriggerStart(i + 1); ++j)
+        {
+            std::string_view s_Key = c_Table.GetTriggerKey(j);
+            
+            if (e_Method != LaunchTrigger::LEVENSHTEIN)
+            {
+                m_Exact.emplace(s_Key, static_cast<MRH_Uint32>(i));
+                continue;
+            }
+            else if (f32_Similarity > 1.f)
+            {
+                // Never matches
+                continue;
+            }
+            
+            auto Key = m_Key.emplace(s_Key, static_cast<MRH_Uint32>(v_KeyTrigger.size()));
+            
+            if (Key.second == true)
+            {
+                v_KeyTrigger.emplace_back();
+            }
+            
+            v_KeyTrigger[Key.first->second].emplace_back(static_cast<MRH_Uint32>(i), f32_Similarity);
+        }
+    }
+    
+    v_Node.resize(v_KeyTrigger.size());
+    
+    for (auto& Key : m_Key)
+    {
+        Node& c_Node = v_Node[Key.second];
+        
+        c_Node.s_Key = Key.first;
+        c_Node.u32_TriggerStart = static_cast<MRH_Uint32>(v_Position.size());
+        c_Node.f32_Similarity = 1.f;
+        
+        for (auto& Trigger : v_KeyTrigger[Key.second])
+        {
+            v_Position.emplace_back(Trigger.first);
+            c_Node.f32_Similarity = std::min(c_Node.f32_Similarity, Trigger.second);
+        }
+        
+        c_Node.u32_TriggerEnd = static_cast<MRH_Uint32>(v_Position.size());
+        c_Node.us_SubtreeLength = c_Node.s_Key.size();
+        c_Node.f32_SubtreeSimilarity = c_Node.f32_Similarity;
+    }
+    
+    // Insert in node order, parents are always inserted before 
+    // their children
+    std::vector<MRH_Uint32> v_Parent(v_Node.size(), 0);
+    
+    for (MRH_Uint32 i = 1; i < v_Node.size(); ++i)
+    {
+        MRH_Uint32 u32_Current = 0;
+        
+        while (true)
+        {
+            Node& c_Current = v_Node[u32_Current];
+            size_t us_Distance = Levenshtein::Distance(v_Node[i].s_Key, c_Current.s_Key);
+            auto Child = std::lower_bound(c_Current.v_Child.begin(),
+                                          c_Current.v_Child.end(),
+                                          std::make_pair(us_Distance, static_cast<MRH_Uint32>(0)));
+            
+            if (Child != c_Current.v_Child.end() && Child->first == us_Distance)
+            {
+                u32_Current = Child->second;
+                continue;
+            }
+            
+            c_Current.v_Child.emplace(Child, us_Distance, i);
+            v_Parent[i] = u32_Current;
+            break;
+        }
+    }
+    
+    for (size_t i = v_Node.size(); i-- > 1;)
+    {
+        Node& c_Parent = v_Node[v_Parent[i]];
+        
+        c_Parent.us_SubtreeLength = std::max(c_Parent.us_SubtreeLength, v_Node[i].us_SubtreeLength);
+        c_Parent.f32_SubtreeSimilarity = std::min(c_Parent.f32_SubtreeSimilarity, v_Node[i].f32_SubtreeSimilarity);
+    }
+}
+
+TriggerTree::~TriggerTree() noexcept
+{}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+void TriggerTree::GetCandidates(std::string_view s_Input,
+                                std::vector<size_t>& v_Result) const
+{
+    v_Result.clear();
+    
+    if (v_Node.size() > 0)
+    {
+        v_Stack.clear();
+        v_Stack.emplace_back(0);
+    }
+    
+    while (v_Stack.size() > 0)
+    {
+        Node const& c_Node = v_Node[v_Stack.back()];
+        v_Stack.pop_back();
+        
+        // The distance is only needed up to the point where the node 
+        // and every child are rejected
+        size_t us_Radius = Levenshtein::MaxDistance(std::max(c_Node.s_Key.size(), s_Input.size()), c_Node.f32_Similarity);
+        size_t us_Bound = us_Radius;
+        
+        for (auto& Child : c_Node.v_Child)
+        {
+            Node const& c_Child = v_Node[Child.second];
+            size_t us_ChildRadius = Levenshtein::MaxDistance(std::max(c_Child.us_SubtreeLength, s_Input.size()), c_Child.f32_SubtreeSimilarity);
+            
+            us_Bound = std::max(us_Bound, Child.first + us_ChildRadius);
+        }
+        
+        size_t us_Distance = Levenshtein::BoundedDistance(c_Node.s_Key, s_Input, us_Bound);
+        
+        if (us_Distance <= us_Radius)
+        {
+            for (MRH_Uint32 i = c_Node.u32_TriggerStart; i < c_Node.u32_TriggerEnd; ++i)
+            {
+                v_Result.emplace_back(v_Position[i]);
+            }
+        }
+        
+        // Triangle inequality, a subtree at distance e only holds keys 
+        // with a input distance of at least |d - e|
+        for (auto& Child : c_Node.v_Child)
+        {
+            Node const& c_Child = v_Node[Child.second];
+            size_t us_ChildRadius = Levenshtein::MaxDistance(std::max(c_Child.us_SubtreeLength, s_Input.size()), c_Child.f32_SubtreeSimilarity);
+            size_t us_Difference = (us_Distance > Child.first ? us_Distance - Child.first : Child.first - us_Distance);
+            
+            if (us_Difference <= us_ChildRadius)
+            {
+                v_Stack.emplace_back(Child.second);
+            }
+        }
+    }
+    
+    auto Exact = m_Exact.equal_range(s_Input);
+    
+    for (auto It = Exact.first; It != Exact.second; ++It)
+    {
+        v_Result.emplace_back(It->second);
+    }
+    
+    std::sort(v_Result.begin(), v_Result.end());
+    v_Result.erase(std::unique(v_Result.begin(), v_Result.end()), v_Result.end());
+}
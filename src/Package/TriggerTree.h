@@ -0,0 +1,123 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef TriggerTree_h
+#define TriggerTree_h
+
+// C / C++
+#include <vector>
+#include <unordered_map>
+#include <string_view>
+
+// External
+
+// Project
+#include "./TriggerTable.h"
+
+
+class TriggerTree
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor. The tree is empty.
+     */
+    
+    TriggerTree() noexcept;
+    
+    /**
+     *  Table constructor.
+     *
+     *  \param c_Table The trigger table to build the tree for. The table 
+     *                 has to outlive the tree and must not change.
+     */
+    
+    TriggerTree(TriggerTable const& c_Table);
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~TriggerTree() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the packages which might match a input. Packages which are not 
+     *  returned are guaranteed to not match. This function is not thread 
+     *  safe.
+     *
+     *  \param s_Input The normalised input to match.
+     *  \param v_Position The package positions in the trigger table, in 
+     *                    ascending order.
+     */
+    
+    void GetCandidates(std::string_view s_Input,
+                       std::vector<size_t>& v_Position) const;
+    
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Node
+    {
+    public:
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        std::string_view s_Key;
+        
+        // Fuzzy triggers with this key
+        MRH_Uint32 u32_TriggerStart;
+        MRH_Uint32 u32_TriggerEnd;
+        float f32_Similarity; // Lowest of all triggers
+        
+        // Subtree bounds, including this node
+        size_t us_SubtreeLength; // Longest key
+        float f32_SubtreeSimilarity; // Lowest similarity
+        
+        // <Distance to this node, Child node>
+        std::vector<std::pair<size_t, MRH_Uint32>> v_Child;
+    };
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::vector<Node> v_Node; // Root first, parents before children
+    std::vector<MRH_Uint32> v_Position; // Package position per node trigger
+    
+    // <Trigger Key, Exact triggers>
+    std::unordered_multimap<std::string_view, MRH_Uint32> m_Exact;
+    
+    // Query buffer
+    mutable std::vector<MRH_Uint32> v_Stack;
+    
+protected:
+    
+};
+
+#endif /* TriggerTree_h */
@@ -0,0 +1,216 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <algorithm>
+#include <cstdlib>
+#include <dirent.h>
+#include <unistd.h>
+
+// External
+#include <libmrhvt/String/MRH_LocalisedPath.h>
+
+// Project
+#include "./LocalisedPathCache.h"
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+LocalisedPathCache::LocalisedPathCache() noexcept
+{}
+
+LocalisedPathCache::~LocalisedPathCache() noexcept
+{}
+
+//*************************************************************************************
+// Singleton
+//*************************************************************************************
+
+LocalisedPathCache& LocalisedPathCache::Singleton() noexcept
+{
+    static LocalisedPathCache c_Cache;
+    return c_Cache;
+}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+void LocalisedPathCache::Invalidate(std::string const& s_Directory) noexcept
+{
+    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    
+    for (auto It = m_Directory.begin(); It != m_Directory.end();)
+    {
+        std::string const& s_Cached = It->first;
+        
+        if (s_Cached.compare(0, s_Directory.size(), s_Directory) == 0 &&
+            (s_Cached.size() == s_Directory.size() || s_Cached[s_Directory.size()] == '/'))
+        {
+            It = m_Directory.erase(It);
+        }
+        else
+        {
+            ++It;
+        }
+    }
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+std::vector<std::string> LocalisedPathCache::GetLocales(std::string const& s_Directory)
+{
+    DIR* p_Directory = opendir(s_Directory.c_str());
+    std::vector<std::string> v_Locale;
+    
+    if (p_Directory == NULL)
+    {
+        return v_Locale;
+    }
+    
+    struct dirent* p_Entry;
+    
+    while ((p_Entry = readdir(p_Directory)) != NULL)
+    {
+        if (p_Entry->d_name[0] != '.' && (p_Entry->d_type == DT_DIR || p_Entry->d_type == DT_UNKNOWN || p_Entry->d_type == DT_LNK))
+        {
+            v_Locale.emplace_back(p_Entry->d_name);
+        }
+    }
+    
+    closedir(p_Directory);
+    
+    // Directory order is not stable
+    std::sort(v_Locale.begin(), v_Locale.end());
+    
+    return v_Locale;
+}
+
+std::string LocalisedPathCache::GetPath(std::string const& s_Directory,
+                                        std::string const& s_File)
+{
+    std::string s_Locale = GetLocale();
+    std::string s_Key = s_File + "\n" + s_Locale;
+    std::vector<std::string> v_Locale;
+    bool b_Listed = false;
+    
+    {
+        std::lock_guard<std::mutex> c_Guard(c_Mutex);
+        auto Directory = m_Directory.find(s_Directory);
+        
+        if (Directory != m_Directory.end())
+        {
+            auto Path = Directory->second.m_Path.find(s_Key);
+            
+            if (Path != Directory->second.m_Path.end())
+            {
+                return Path->second;
+            }
+            
+            v_Locale = Directory->second.v_Locale;
+            b_Listed = true;
+        }
+    }
+    
+    // The directory is only listed once, the file once per 
+    // locale subdirectory
+    if (b_Listed == false)
+    {
+        v_Locale = GetLocales(s_Directory);
+    }
+    
+    // The library falls back to other locales if the file is missing, 
+    // which locales provide the file is part of the layout
+    std::string s_Layout = s_Locale + "\n";
+    std::string s_Exists;
+    
+    for (auto& Locale : v_Locale)
+    {
+        s_Layout += Locale;
+        s_Layout += '/';
+        s_Exists += (access((s_Directory + "/" + Locale + "/" + s_File).c_str(), F_OK) == 0 ? '1' : '0');
+    }
+    
+    s_Layout += '\n';
+    s_Layout += s_Exists;
+    s_Layout += '\n';
+    s_Layout += s_File;
+    
+    std::string s_Path;
+    
+    {
+        std::lock_guard<std::mutex> c_Guard(c_Mutex);
+        auto Locale = m_Locale.find(s_Layout);
+        
+        if (Locale != m_Locale.end())
+        {
+            s_Path = s_Directory + "/" + Locale->second + "/" + s_File;
+        }
+    }
+    
+    // Unknown locale layout, let the library choose and remember 
+    // the chosen locale subdirectory
+    if (s_Path.size() == 0)
+    {
+        s_Path = MRH_LocalisedPath::GetPath(s_Directory, s_File);
+        
+        size_t us_Prefix = s_Directory.size() + 1;
+        size_t us_Suffix = s_File.size() + 1;
+        
+        if (s_Path.size() > us_Prefix + us_Suffix &&
+            s_Path.compare(0, s_Directory.size(), s_Directory) == 0 &&
+            s_Path[s_Directory.size()] == '/' &&
+            s_Path.compare(s_Path.size() - us_Suffix, us_Suffix, "/" + s_File) == 0)
+        {
+            std::lock_guard<std::mutex> c_Guard(c_Mutex);
+            m_Locale[s_Layout] = s_Path.substr(us_Prefix, s_Path.size() - us_Prefix - us_Suffix);
+        }
+    }
+    
+    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    Directory& c_Directory = m_Directory[s_Directory];
+    
+    if (b_Listed == false)
+    {
+        c_Directory.v_Locale = std::move(v_Locale);
+    }
+    
+    c_Directory.m_Path[s_Key] = s_Path;
+    
+    return s_Path;
+}
+
+std::string LocalisedPathCache::GetLocale()
+{
+    // Same precedence as the C library message locale
+    const char* p_Variable[3] = { "LC_ALL", "LC_MESSAGES", "LANG" };
+    
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const char* p_Value = std::getenv(p_Variable[i]);
+        
+        if (p_Value != NULL && p_Value[0] != '\0')
+        {
+            return p_Value;
+        }
+    }
+    
+    return "";
+}
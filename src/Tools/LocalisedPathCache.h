@@ -0,0 +1,155 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef LocalisedPathCache_h
+#define LocalisedPathCache_h
+
+// C / C++
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+// External
+
+// Project
+
+
+class LocalisedPathCache
+{
+public:
+    
+    //*************************************************************************************
+    // Singleton
+    //*************************************************************************************
+    
+    /**
+     *  Get the class instance.
+     *
+     *  \return The class instance.
+     */
+    
+    static LocalisedPathCache& Singleton() noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Remove all cached resolutions of a directory and its subdirectories. 
+     *  Used if the directory contents changed.
+     *
+     *  \param s_Directory The full path to the directory.
+     */
+    
+    void Invalidate(std::string const& s_Directory) noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the localised path to a file. Resolved paths are kept per 
+     *  directory, file and locale until invalidated and returned without 
+     *  filesystem access. Directories with the same locale subdirectories 
+     *  providing the file resolve to the same locale without asking the 
+     *  library.
+     *
+     *  \param s_Directory The directory containing the locale subdirectories.
+     *  \param s_File The file name.
+     *
+     *  \return The full path to the localised file.
+     */
+    
+    std::string GetPath(std::string const& s_Directory,
+                        std::string const& s_File);
+    
+    /**
+     *  Get the current locale, following the POSIX message locale 
+     *  environment.
+     *
+     *  \return The current locale.
+     */
+    
+    static std::string GetLocale();
+    
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Directory
+    {
+    public:
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        std::vector<std::string> v_Locale; // Sorted locale subdirectories
+        
+        // <File and Locale, Full Path>
+        std::unordered_map<std::string, std::string> m_Path;
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    LocalisedPathCache() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~LocalisedPathCache() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  List the locale subdirectories of a directory.
+     *
+     *  \param s_Directory The directory containing the locale subdirectories.
+     *
+     *  \return The sorted locale subdirectory names.
+     */
+    
+    static std::vector<std::string> GetLocales(std::string const& s_Directory);
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::mutex c_Mutex;
+    
+    // <Full Directory Path, Directory>
+    std::unordered_map<std::string, Directory> m_Directory;
+    
+    // <Locale, Subdirectories, Provided Files and File, Chosen Subdirectory>
+    std::unordered_map<std::string, std::string> m_Locale;
+    
+protected:
+    
+};
+
+#endif /* LocalisedPathCache_h */
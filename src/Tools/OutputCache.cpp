@@ -0,0 +1,186 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+// C / C++
+#include <unistd.h>
+#include <sys/inotify.h>
+
+// External
+#include <libmrhab/Module/Tools/MRH_ModuleLogger.h>
+
+// Project
+#include "./OutputCache.h"
+#include "./LocalisedPathCache.h"
+
+namespace
+{
+    // Replaced files drop their link count (IN_ATTRIB)
+    constexpr MRH_Uint32 u32_FileMask = IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF;
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+OutputCache::OutputCache() noexcept : i_FD(-1)
+{
+    i_FD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    
+    if (i_FD < 0)
+    {
+        MRH_ModuleLogger::Singleton().Log("OutputCache", "Failed to create inotify instance, output files are not cached!",
+                                          "OutputCache.cpp", __LINE__);
+    }
+}
+
+OutputCache::~OutputCache() noexcept
+{
+    if (i_FD >= 0)
+    {
+        close(i_FD);
+    }
+}
+
+//*************************************************************************************
+// Generate
+//*************************************************************************************
+
+std::string OutputCache::Generate(std::string const& s_Directory,
+                                  std::string const& s_File)
+{
+    Update();
+    
+    // Entries replace the path resolution, the locale is part of the key
+    std::string s_Key = s_Directory + "\n" + s_File + "\n" + LocalisedPathCache::GetLocale();
+    auto Cached = m_Entry.find(s_Key);
+    
+    if (Cached != m_Entry.end())
+    {
+        return Cached->second.p_Generator->Generate();
+    }
+    
+    std::string s_Path = LocalisedPathCache::Singleton().GetPath(s_Directory, 
+                                                                 s_File);
+    
+    // Watch before parsing, a change while parsing then removes 
+    // the entry on the next update
+    int i_WD = (i_FD >= 0 ? inotify_add_watch(i_FD, s_Path.c_str(), u32_FileMask) : -1);
+    
+    if (i_WD >= 0 && m_Watch.count(i_WD) > 0)
+    {
+        // Same file for another key, already watched
+        i_WD = -1;
+    }
+    
+    std::unique_ptr<MRH_OutputGenerator> p_Generator;
+    std::string s_Output;
+    
+    try
+    {
+        p_Generator = std::make_unique<MRH_OutputGenerator>(s_Path);
+        s_Output = p_Generator->Generate();
+    }
+    catch (...)
+    {
+        if (i_WD >= 0)
+        {
+            inotify_rm_watch(i_FD, i_WD);
+        }
+        
+        throw;
+    }
+    
+    if (i_WD >= 0)
+    {
+        try
+        {
+            m_Watch[i_WD] = s_Key;
+            m_Entry[s_Key] = { std::move(p_Generator), s_Directory, i_WD };
+        }
+        catch (...)
+        {
+            // Not caching is always valid
+            inotify_rm_watch(i_FD, i_WD);
+            m_Watch.erase(i_WD);
+            m_Entry.erase(s_Key);
+        }
+    }
+    
+    return s_Output;
+}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+void OutputCache::Update() noexcept
+{
+    if (i_FD < 0)
+    {
+        return;
+    }
+    
+    alignas(struct inotify_event) char p_Buffer[4096];
+    ssize_t ss_Read;
+    
+    while ((ss_Read = read(i_FD, p_Buffer, sizeof(p_Buffer))) > 0)
+    {
+        for (char* p_Pos = p_Buffer; p_Pos < p_Buffer + ss_Read;)
+        {
+            struct inotify_event* p_Event = reinterpret_cast<struct inotify_event*>(p_Pos);
+            p_Pos += sizeof(struct inotify_event) + p_Event->len;
+            
+            if (p_Event->mask & IN_Q_OVERFLOW)
+            {
+                // Events were lost, parse everything again
+                while (m_Watch.size() > 0)
+                {
+                    Remove(m_Watch.begin()->first);
+                }
+                
+                continue;
+            }
+            
+            Remove(p_Event->wd);
+        }
+    }
+}
+
+void OutputCache::Remove(int i_WD) noexcept
+{
+    auto Watch = m_Watch.find(i_WD);
+    
+    if (Watch == m_Watch.end())
+    {
+        return;
+    }
+    
+    // Removed files already dropped their watch
+    inotify_rm_watch(i_FD, i_WD);
+    
+    // The file might now resolve to another locale
+    auto Entry = m_Entry.find(Watch->second);
+    
+    if (Entry != m_Entry.end())
+    {
+        LocalisedPathCache::Singleton().Invalidate(Entry->second.s_Directory);
+        m_Entry.erase(Entry);
+    }
+    
+    m_Watch.erase(Watch);
+}
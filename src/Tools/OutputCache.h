@@ -0,0 +1,123 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#ifndef OutputCache_h
+#define OutputCache_h
+
+// C / C++
+#include <string>
+#include <memory>
+#include <unordered_map>
+
+// External
+#include <libmrhvt/Output/MRH_OutputGenerator.h>
+
+// Project
+
+
+class OutputCache
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor. Without file watching nothing is cached.
+     */
+    
+    OutputCache() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~OutputCache() noexcept;
+    
+    //*************************************************************************************
+    // Generate
+    //*************************************************************************************
+    
+    /**
+     *  Generate output from a localised output file. Parsed files are 
+     *  kept per directory, file and locale until the file changes, cached 
+     *  output is generated without resolving the path again.
+     *
+     *  \param s_Directory The directory containing the locale subdirectories.
+     *  \param s_File The output file name.
+     *
+     *  \return The generated output.
+     */
+    
+    std::string Generate(std::string const& s_Directory,
+                         std::string const& s_File);
+    
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Entry
+    {
+    public:
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        std::unique_ptr<MRH_OutputGenerator> p_Generator;
+        std::string s_Directory; // Locale directory of the parsed file
+        int i_WD;
+    };
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Remove all parsed files which changed since the last update.
+     */
+    
+    void Update() noexcept;
+    
+    /**
+     *  Remove a parsed file.
+     *
+     *  \param i_WD The watch descriptor of the file.
+     */
+    
+    void Remove(int i_WD) noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    int i_FD;
+    
+    // <Directory, File and Locale, Parsed File>
+    std::unordered_map<std::string, Entry> m_Entry;
+    
+    // <Watch Descriptor, Directory, File and Locale>
+    std::unordered_map<int, std::string> m_Watch;
+    
+protected:
+    
+};
+
+#endif /* OutputCache_h */
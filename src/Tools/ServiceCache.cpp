@@ -0,0 +1,149 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+// C / C++
+
+// External
+
+// Project
+#include "./ServiceCache.h"
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+ServiceCache::ServiceCache(MRH_Uint64 u64_AvailableMS,
+                           MRH_Uint64 u64_BackoffMinMS,
+                           MRH_Uint64 u64_BackoffMaxMS) noexcept : c_AvailableTime(std::chrono::milliseconds(u64_AvailableMS)),
+                                                                   u64_BackoffMinMS(u64_BackoffMinMS),
+                                                                   u64_BackoffMaxMS(u64_BackoffMaxMS),
+                                                                   c_Jitter(static_cast<std::minstd_rand::result_type>(Clock::now().time_since_epoch().count()))
+{
+    // Nothing confirmed, nothing to wait for
+    for (MRH_Uint32 i = 0; i < u32_ServiceCount; ++i)
+    {
+        p_Service[i].c_Available = Clock::time_point::min();
+        p_Service[i].c_Retry = Clock::time_point::min();
+        p_Service[i].u32_Failed = 0;
+    }
+}
+
+ServiceCache::~ServiceCache() noexcept
+{}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+void ServiceCache::SetAvailable(MRH_Uint32 u32_Service,
+                                bool b_Available) noexcept
+{
+    if (u32_Service >= u32_ServiceCount)
+    {
+        return;
+    }
+    
+    Service& c_Service = p_Service[u32_Service];
+    Clock::time_point c_Now = Clock::now();
+    
+    if (b_Available == true)
+    {
+        c_Service.c_Available = c_Now;
+        c_Service.c_Retry = Clock::time_point::min();
+        c_Service.u32_Failed = 0;
+        return;
+    }
+    
+    // Double per failure up to the limit
+    MRH_Uint64 u64_BackoffMS = u64_BackoffMinMS;
+    
+    for (MRH_Uint32 i = 0; i < c_Service.u32_Failed && u64_BackoffMS < u64_BackoffMaxMS; ++i)
+    {
+        u64_BackoffMS *= 2;
+    }
+    
+    if (u64_BackoffMS >= u64_BackoffMaxMS)
+    {
+        u64_BackoffMS = u64_BackoffMaxMS;
+    }
+    else
+    {
+        ++(c_Service.u32_Failed);
+    }
+    
+    // Wait at least half, a random share of the rest keeps retries of 
+    // multiple clients apart
+    MRH_Uint64 u64_JitterMS = u64_BackoffMS - (u64_BackoffMS / 2);
+    
+    if (u64_JitterMS > 0)
+    {
+        u64_BackoffMS = (u64_BackoffMS / 2) + (c_Jitter() % (u64_JitterMS + 1));
+    }
+    
+    c_Service.c_Available = Clock::time_point::min();
+    c_Service.c_Retry = c_Now + std::chrono::milliseconds(u64_BackoffMS);
+}
+
+void ServiceCache::Invalidate(MRH_Uint32 u32_Service) noexcept
+{
+    if (u32_Service >= u32_ServiceCount)
+    {
+        return;
+    }
+    
+    // Keep a running backoff, only the confirmation is dropped
+    p_Service[u32_Service].c_Available = Clock::time_point::min();
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+bool ServiceCache::GetAvailable(MRH_Uint32 u32_Service) const noexcept
+{
+    if (u32_Service >= u32_ServiceCount || p_Service[u32_Service].c_Available == Clock::time_point::min())
+    {
+        return false;
+    }
+    
+    return Clock::now() - p_Service[u32_Service].c_Available < c_AvailableTime;
+}
+
+MRH_Uint64 ServiceCache::GetWaitMS(MRH_Uint32 u32_ServiceMask) const noexcept
+{
+    Clock::time_point c_Now = Clock::now();
+    MRH_Uint64 u64_WaitMS = 0;
+    
+    for (MRH_Uint32 i = 0; i < u32_ServiceCount; ++i)
+    {
+        if ((u32_ServiceMask & (static_cast<MRH_Uint32>(1) << i)) == 0 || p_Service[i].c_Retry <= c_Now)
+        {
+            continue;
+        }
+        
+        // Round up, a wait of 0 means the check can start
+        MRH_Uint64 u64_ServiceMS = static_cast<MRH_Uint64>(std::chrono::ceil<std::chrono::milliseconds>(p_Service[i].c_Retry - c_Now).count());
+        
+        if (u64_ServiceMS > u64_WaitMS)
+        {
+            u64_WaitMS = u64_ServiceMS;
+        }
+    }
+    
+    return u64_WaitMS;
+}
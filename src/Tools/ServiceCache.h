@@ -0,0 +1,147 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#ifndef ServiceCache_h
+#define ServiceCache_h
+
+// C / C++
+#include <chrono>
+#include <random>
+
+// External
+#include <MRH_Typedefs.h>
+
+// Project
+
+
+class ServiceCache
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor. Service ids are the bit positions of a 
+     *  service mask.
+     *
+     *  \param u64_AvailableMS The time in milliseconds a available service 
+     *                        is trusted without checking again.
+     *  \param u64_BackoffMinMS The time in milliseconds to wait after the 
+     *                          first failed check.
+     *  \param u64_BackoffMaxMS The longest time in milliseconds to wait 
+     *                          after repeated failed checks.
+     */
+    
+    ServiceCache(MRH_Uint64 u64_AvailableMS,
+                 MRH_Uint64 u64_BackoffMinMS,
+                 MRH_Uint64 u64_BackoffMaxMS) noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~ServiceCache() noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Set the result of a service check. Failed checks double the wait 
+     *  before the next check, with a random jitter to spread retries.
+     *
+     *  \param u32_Service The id of the checked service.
+     *  \param b_Available If the service is available.
+     */
+    
+    void SetAvailable(MRH_Uint32 u32_Service,
+                      bool b_Available) noexcept;
+    
+    /**
+     *  Forget the confirmed availability of a service. The service is 
+     *  checked again on next use without waiting.
+     *
+     *  \param u32_Service The id of the service.
+     */
+    
+    void Invalidate(MRH_Uint32 u32_Service) noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Check if a service was recently confirmed to be available.
+     *
+     *  \param u32_Service The id of the service.
+     *
+     *  \return true if the service is available, false if it has to be checked.
+     */
+    
+    bool GetAvailable(MRH_Uint32 u32_Service) const noexcept;
+    
+    /**
+     *  Get the time to wait before services can be checked again.
+     *
+     *  \param u32_ServiceMask The services to check.
+     *
+     *  \return The longest wait of all services in milliseconds.
+     */
+    
+    MRH_Uint64 GetWaitMS(MRH_Uint32 u32_ServiceMask) const noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    typedef std::chrono::steady_clock Clock;
+    
+    struct Service
+    {
+    public:
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        Clock::time_point c_Available; // Last confirmed availability
+        Clock::time_point c_Retry; // Next check after a failure
+        MRH_Uint32 u32_Failed; // Failed checks in a row
+    };
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    static constexpr MRH_Uint32 u32_ServiceCount = 32;
+    
+    Clock::duration c_AvailableTime;
+    MRH_Uint64 u64_BackoffMinMS;
+    MRH_Uint64 u64_BackoffMaxMS;
+    
+    Service p_Service[u32_ServiceCount];
+    std::minstd_rand c_Jitter;
+    
+protected:
+    
+};
+
+#endif /* ServiceCache_h */
@@ -0,0 +1,102 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <cstring>
+
+// External
+
+// Project
+#include "./StringPool.h"
+
+// Pre-defined
+#ifndef STRING_POOL_BLOCK_SIZE
+    #define STRING_POOL_BLOCK_SIZE 16384
+#endif
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+StringPool::StringPool() noexcept : p_Block(NULL),
+                                    us_BlockUsed(0),
+                                    us_Size(0)
+{}
+
+StringPool::~StringPool() noexcept
+{}
+
+//*************************************************************************************
+// Add
+//*************************************************************************************
+
+std::string_view StringPool::Add(std::string_view s_Add)
+{
+    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    
+    auto Pooled = s_String.find(s_Add);
+    
+    if (Pooled != s_String.end())
+    {
+        return *Pooled;
+    }
+    
+    // Large strings get their own block, the current block stays in use
+    size_t us_Required = s_Add.size() + 1;
+    char* p_String;
+    
+    if (us_Required > STRING_POOL_BLOCK_SIZE / 4)
+    {
+        v_Block.emplace_back(std::make_unique<char[]>(us_Required));
+        p_String = v_Block.back().get();
+        us_Size += us_Required;
+    }
+    else
+    {
+        if (p_Block == NULL || STRING_POOL_BLOCK_SIZE - us_BlockUsed < us_Required)
+        {
+            v_Block.emplace_back(std::make_unique<char[]>(STRING_POOL_BLOCK_SIZE));
+            p_Block = v_Block.back().get();
+            us_BlockUsed = 0;
+            us_Size += STRING_POOL_BLOCK_SIZE;
+        }
+        
+        p_String = p_Block + us_BlockUsed;
+        us_BlockUsed += us_Required;
+    }
+    
+    std::memcpy(p_String, s_Add.data(), s_Add.size());
+    p_String[s_Add.size()] = '\0';
+    
+    return *(s_String.emplace(p_String, s_Add.size()).first);
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+size_t StringPool::GetStringCount() noexcept
+{
+    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    return s_String.size();
+}
+
+size_t StringPool::GetSize() noexcept
+{
+    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    return us_Size;
+}
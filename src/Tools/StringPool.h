@@ -0,0 +1,109 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef StringPool_h
+#define StringPool_h
+
+// C / C++
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+// External
+
+// Project
+
+
+class StringPool
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    StringPool() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~StringPool() noexcept;
+    
+    StringPool(StringPool const&) = delete;
+    StringPool& operator=(StringPool const&) = delete;
+    
+    //*************************************************************************************
+    // Add
+    //*************************************************************************************
+    
+    /**
+     *  Add a string to the pool. Equal strings are only stored once. Pooled 
+     *  strings are null terminated and valid for the lifetime of the pool.
+     *
+     *  \param s_Add The string to add.
+     *
+     *  \return The pooled string.
+     */
+    
+    std::string_view Add(std::string_view s_Add);
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the amount of unique strings in the pool.
+     *
+     *  \return The string count.
+     */
+    
+    size_t GetStringCount() noexcept;
+    
+    /**
+     *  Get the amount of bytes reserved by the pool.
+     *
+     *  \return The reserved bytes.
+     */
+    
+    size_t GetSize() noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::mutex c_Mutex;
+    
+    std::vector<std::unique_ptr<char[]>> v_Block;
+    char* p_Block;
+    size_t us_BlockUsed;
+    size_t us_Size;
+    
+    std::unordered_set<std::string_view> s_String;
+    
+protected:
+    
+};
+
+#endif /* StringPool_h */
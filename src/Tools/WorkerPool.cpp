@@ -0,0 +1,164 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+
+// External
+
+// Project
+#include "./WorkerPool.h"
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+WorkerPool::WorkerPool(size_t us_ThreadCount) noexcept : p_Task(NULL),
+                                                         us_Count(0),
+                                                         us_Next(0),
+                                                         us_Active(0),
+                                                         u64_Generation(0),
+                                                         b_Shutdown(false)
+{
+    for (size_t i = 0; i < us_ThreadCount; ++i)
+    {
+        try
+        {
+            v_Thread.emplace_back(&WorkerPool::Work, this);
+        }
+        catch (...)
+        {
+            // Continue with what we have, the calling thread
+            // will always work as well
+            break;
+        }
+    }
+}
+
+WorkerPool::~WorkerPool() noexcept
+{
+    c_Mutex.lock();
+    b_Shutdown = true;
+    c_Mutex.unlock();
+    
+    c_StartCondition.notify_all();
+    
+    for (auto& Thread : v_Thread)
+    {
+        Thread.join();
+    }
+}
+
+//*************************************************************************************
+// Run
+//*************************************************************************************
+
+void WorkerPool::Run(size_t us_Count, Task const& c_Task) noexcept
+{
+    if (us_Count == 0)
+    {
+        return;
+    }
+    else if (us_Count == 1 || v_Thread.size() == 0)
+    {
+        for (size_t i = 0; i < us_Count; ++i)
+        {
+            c_Task(i);
+        }
+        
+        return;
+    }
+    
+    std::unique_lock<std::mutex> c_Lock(c_Mutex);
+    
+    p_Task = &c_Task;
+    this->us_Count = us_Count;
+    us_Next = 0;
+    us_Active = v_Thread.size();
+    ++u64_Generation;
+    
+    c_Lock.unlock();
+    c_StartCondition.notify_all();
+    
+    Process();
+    
+    // Wait for all workers, the task reference is only valid
+    // during this call
+    c_Lock.lock();
+    c_FinishCondition.wait(c_Lock, [this]() { return us_Active == 0; });
+    p_Task = NULL;
+}
+
+void WorkerPool::Process() noexcept
+{
+    for (size_t i = us_Next++; i < us_Count; i = us_Next++)
+    {
+        (*p_Task)(i);
+    }
+}
+
+void WorkerPool::Work() noexcept
+{
+    unsigned long long u64_Seen = 0;
+    std::unique_lock<std::mutex> c_Lock(c_Mutex);
+    
+    while (true)
+    {
+        c_StartCondition.wait(c_Lock, [&]() { return b_Shutdown == true || u64_Generation != u64_Seen; });
+        
+        if (b_Shutdown == true)
+        {
+            return;
+        }
+        
+        u64_Seen = u64_Generation;
+        
+        c_Lock.unlock();
+        Process();
+        c_Lock.lock();
+        
+        if (--us_Active == 0)
+        {
+            c_FinishCondition.notify_all();
+        }
+    }
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+size_t WorkerPool::GetThreadCount() const noexcept
+{
+    return v_Thread.size();
+}
+
+size_t WorkerPool::GetWorkerCount(size_t us_ThreadMax, size_t us_Count) noexcept
+{
+    size_t us_ThreadCount = std::thread::hardware_concurrency();
+    
+    if (us_ThreadCount > us_ThreadMax)
+    {
+        us_ThreadCount = us_ThreadMax;
+    }
+    if (us_ThreadCount > us_Count)
+    {
+        us_ThreadCount = us_Count;
+    }
+    
+    // The calling thread works as well
+    return (us_ThreadCount > 1 ? us_ThreadCount - 1 : 0);
+}
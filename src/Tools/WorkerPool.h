@@ -0,0 +1,139 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef WorkerPool_h
+#define WorkerPool_h
+
+// C / C++
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <vector>
+
+// External
+
+// Project
+
+
+class WorkerPool
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    typedef std::function<void(size_t)> Task;
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param us_ThreadCount The amount of worker threads to create.
+     */
+    
+    WorkerPool(size_t us_ThreadCount) noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~WorkerPool() noexcept;
+    
+    //*************************************************************************************
+    // Run
+    //*************************************************************************************
+    
+    /**
+     *  Run a task for every index in [0, us_Count). The calling thread takes part 
+     *  in the work and returns once every index was processed.
+     *
+     *  \param us_Count The amount of indices to process.
+     *  \param c_Task The task to run for each index. The task must not throw.
+     */
+    
+    void Run(size_t us_Count, Task const& c_Task) noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the amount of worker threads.
+     *
+     *  \return The amount of worker threads.
+     */
+    
+    size_t GetThreadCount() const noexcept;
+    
+    /**
+     *  Get the amount of worker threads to create for a task. The calling 
+     *  thread works as well and is counted towards the thread limit.
+     *
+     *  \param us_ThreadMax The highest amount of threads to use, including 
+     *                      the calling thread.
+     *  \param us_Count The amount of indices the task processes.
+     *
+     *  \return The amount of worker threads.
+     */
+    
+    static size_t GetWorkerCount(size_t us_ThreadMax, size_t us_Count) noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Run
+    //*************************************************************************************
+    
+    /**
+     *  Process indices until none are left.
+     */
+    
+    void Process() noexcept;
+    
+    /**
+     *  Worker thread loop.
+     */
+    
+    void Work() noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::vector<std::thread> v_Thread;
+    
+    std::mutex c_Mutex;
+    std::condition_variable c_StartCondition;
+    std::condition_variable c_FinishCondition;
+    
+    Task const* p_Task;
+    size_t us_Count;
+    std::atomic<size_t> us_Next;
+    size_t us_Active;
+    unsigned long long u64_Generation;
+    bool b_Shutdown;
+    
+protected:
+    
+};
+
+#endif /* WorkerPool_h */